@@ -11,6 +11,7 @@
 #include "impl/version.h"
 
 #include "daw_from_json_fwd.h"
+#include "daw_json_iterator.h"
 #include "impl/daw_json_parse_class.h"
 #include "impl/daw_json_parse_value.h"
 #include "impl/daw_json_value.h"
@@ -23,6 +24,63 @@
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
 
+		namespace json_details {
+			/// @brief from_json with the flags of the parse policy already built.
+			/// See from_json( String &&, parse_flags_t )
+			template<typename JsonMember, bool KnownBounds,
+			         json_options_t PolicyFlags, typename String>
+			[[nodiscard]] constexpr auto from_json_with_flags( String &&json_data ) {
+				static_assert(
+				  is_string_view_like_v<String>,
+				  "String type must have a be a contiguous range of Characters" );
+				daw_json_ensure( std::data( json_data ) != nullptr,
+				                 ErrorReason::EmptyJSONPath );
+				daw_json_ensure( std::size( json_data ) != 0,
+				                 ErrorReason::EmptyJSONDocument );
+
+				static_assert(
+				  has_json_deduced_type_v<JsonMember>,
+				  "Missing specialization of daw::json::json_data_contract for class "
+				  "mapping or specialization of daw::json::json_link_basic_type_map" );
+				using json_member = json_deduced_type<JsonMember>;
+				using ParsePolicy = BasicParsePolicy<PolicyFlags>;
+
+				/// If the string is known to have a trailing zero, allow optimization
+				/// on that
+				using policy_zstring_t = apply_zstring_policy_option_t<
+				  ParsePolicy, String, options::ZeroTerminatedString::yes>;
+
+				/// In cases where we own the buffer or when requested and can, allow
+				/// temporarily mutating it to reduce search costs
+				using ParseState = apply_mutable_policy<
+				  policy_zstring_t, String, options::TemporarilyMutateBuffer::yes,
+				  options::TemporarilyMutateBuffer::no>;
+				static_assert( not ParseState::is_in_situ_strings or
+				                 is_mutable_string_v<String>,
+				               "options::InSituStrings requires a mutable buffer" );
+				auto parse_state =
+				  ParseState( std::data( json_data ), daw::data_end( json_data ) );
+
+				/// @brief See options::StructuralIndex.  The index must outlive the
+				/// parse, it is empty when the option is not enabled
+				auto const structural_index = make_structural_index<ParseState>(
+				  std::data( json_data ), daw::data_end( json_data ) );
+				parse_state.set_structural_index( structural_index );
+
+				if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
+					auto result = parse_value<json_member, KnownBounds>(
+					  parse_state, ParseTag<json_member::expected_type>{ } );
+					parse_state.trim_left( );
+					daw_json_ensure( parse_state.empty( ),
+					                 ErrorReason::InvalidEndOfValue, parse_state );
+					return result;
+				} else {
+					return parse_value<json_member, KnownBounds>(
+					  parse_state, ParseTag<json_member::expected_type>{ } );
+				}
+			}
+		} // namespace json_details
+
 		/// @brief Construct the JSONMember from the JSON document argument.
 		/// @tparam JsonMember any bool, arithmetic, string, string_view,
 		/// daw::json::json_data_contract
@@ -35,46 +93,9 @@ namespace daw::json {
 		         auto... PolicyFlags>
 		[[nodiscard]] constexpr auto
 		from_json( String &&json_data, options::parse_flags_t<PolicyFlags...> ) {
-			static_assert(
-			  json_details::is_string_view_like_v<String>,
-			  "String type must have a be a contiguous range of Characters" );
-			daw_json_ensure( std::data( json_data ) != nullptr,
-			                 ErrorReason::EmptyJSONPath );
-			daw_json_ensure( std::size( json_data ) != 0,
-			                 ErrorReason::EmptyJSONDocument );
-
-			static_assert(
-			  json_details::has_json_deduced_type_v<JsonMember>,
-			  "Missing specialization of daw::json::json_data_contract for class "
-			  "mapping or specialization of daw::json::json_link_basic_type_map" );
-			using json_member = json_details::json_deduced_type<JsonMember>;
-			using ParsePolicy =
-			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
-
-			/// If the string is known to have a trailing zero, allow optimization on
-			/// that
-			using policy_zstring_t = json_details::apply_zstring_policy_option_t<
-			  ParsePolicy, String, options::ZeroTerminatedString::yes>;
-
-			/// In cases where we own the buffer or when requested and can, allow
-			/// temporarily mutating it to reduce search costs
-			using ParseState = json_details::apply_mutable_policy<
-			  policy_zstring_t, String, options::TemporarilyMutateBuffer::yes,
-			  options::TemporarilyMutateBuffer::no>;
-			auto parse_state =
-			  ParseState( std::data( json_data ), daw::data_end( json_data ) );
-
-			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
-				auto result = json_details::parse_value<json_member, KnownBounds>(
-				  parse_state, ParseTag<json_member::expected_type>{ } );
-				parse_state.trim_left( );
-				daw_json_ensure( parse_state.empty( ), ErrorReason::InvalidEndOfValue,
-				                 parse_state );
-				return result;
-			} else {
-				return json_details::parse_value<json_member, KnownBounds>(
-				  parse_state, ParseTag<json_member::expected_type>{ } );
-			}
+			return json_details::from_json_with_flags<
+			  JsonMember, KnownBounds, options::parse_flags_t<PolicyFlags...>::value>(
+			  DAW_FWD( json_data ) );
 		}
 
 		/// @brief Construct the JSONMember from the JSON document argument.
@@ -139,8 +160,18 @@ namespace daw::json {
 			using ParseState = json_details::apply_mutable_policy<
 			  policy_zstring_t, String, options::TemporarilyMutateBuffer::yes,
 			  options::TemporarilyMutateBuffer::no>;
+			static_assert( not ParseState::is_in_situ_strings or
+			                 json_details::is_mutable_string_v<String>,
+			               "options::InSituStrings requires a mutable buffer" );
 
 			auto parse_state = ParseState::with_allocator( f, l, a );
+
+			/// @brief See options::StructuralIndex.  The index must outlive the
+			/// parse, it is empty when the option is not enabled
+			auto const structural_index =
+			  json_details::make_structural_index<ParseState>( f, l );
+			parse_state.set_structural_index( structural_index );
+
 			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
 				auto result = json_details::parse_value<json_member, KnownBounds>(
 				  parse_state, ParseTag<json_member::expected_type>{ } );
@@ -218,6 +249,9 @@ namespace daw::json {
 			using ParseState = json_details::apply_mutable_policy<
 			  policy_zstring_t, String, options::TemporarilyMutateBuffer::yes,
 			  options::TemporarilyMutateBuffer::no>;
+			static_assert( not ParseState::is_in_situ_strings,
+			               "options::InSituStrings is not supported with a "
+			               "member_path" );
 
 			auto jv = basic_json_value(
 			  ParseState( std::data( json_data ), daw::data_end( json_data ) ) );
@@ -312,6 +346,9 @@ namespace daw::json {
 			using ParseState = json_details::apply_mutable_policy<
 			  policy_zstring_t, String, options::TemporarilyMutateBuffer::yes,
 			  options::TemporarilyMutateBuffer::no>;
+			static_assert( not ParseState::is_in_situ_strings,
+			               "options::InSituStrings is not supported with a "
+			               "member_path" );
 
 			auto first = std::data( json_data );
 			auto last = daw::data_end( json_data );
@@ -384,6 +421,9 @@ namespace daw::json {
 			  "mapping or specialization of daw::json::json_link_basic_type_map" );
 			using ParsePolicy = typename BasicParsePolicy<
 			  P, Allocator>::template SetPolicyOptions<PolicyFlags...>;
+			static_assert(
+			  not ParsePolicy::is_in_situ_strings,
+			  "options::InSituStrings is not supported with json_value" );
 
 			auto const old_parse_state = value.get_raw_state( );
 			auto parse_state =
@@ -434,6 +474,9 @@ namespace daw::json {
 			  "mapping or specialization of daw::json::json_link_basic_type_map" );
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			static_assert(
+			  not ParsePolicy::is_in_situ_strings,
+			  "options::InSituStrings is not supported with json_value" );
 			auto const old_parse_state = value.get_raw_state( );
 
 			auto jv = basic_json_value(
@@ -523,10 +566,20 @@ namespace daw::json {
 			using ParseState = json_details::apply_mutable_policy<
 			  policy_zstring_t, String, options::TemporarilyMutateBuffer::yes,
 			  options::TemporarilyMutateBuffer::no>;
+			static_assert( not ParseState::is_in_situ_strings or
+			                 json_details::is_mutable_string_v<String>,
+			               "options::InSituStrings requires a mutable buffer" );
 
 			auto parse_state =
 			  ParseState{ std::data( json_data ), daw::data_end( json_data ) };
 
+			/// @brief See options::StructuralIndex.  The index must outlive the
+			/// parse, it is empty when the option is not enabled
+			auto const structural_index =
+			  json_details::make_structural_index<ParseState>(
+			    std::data( json_data ), daw::data_end( json_data ) );
+			parse_state.set_structural_index( structural_index );
+
 			parse_state.trim_left_unchecked( );
 #if defined( _MSC_VER ) and not defined( __clang__ )
 			// Work around MSVC ICE
@@ -623,6 +676,9 @@ namespace daw::json {
 			using ParseState = json_details::apply_mutable_policy<
 			  policy_zstring_t, String, options::TemporarilyMutateBuffer::yes,
 			  options::TemporarilyMutateBuffer::no>;
+			static_assert( not ParseState::is_in_situ_strings,
+			               "options::InSituStrings is not supported with a "
+			               "member_path" );
 
 			auto jv = basic_json_value(
 			  ParseState( std::data( json_data ), daw::data_end( json_data ) ) );
@@ -685,5 +741,62 @@ namespace daw::json {
 			return from_json_array<JsonElement, Container, Constructor, KnownBounds>(
 			  DAW_FWD( json_data ), member_path, options::parse_flags<> );
 		}
+
+		/// @brief Parse a slice of an array's elements.  This allows starting at
+		/// any element boundary, e.g. from json_structural_index
+		/// @tparam JsonElement The type of each element in array.  Must be one of
+		/// the above json_XXX classes.  This version is checked
+		/// @tparam Container Container to store values in
+		/// @tparam Constructor Callable to construct Container with no arguments
+		/// @param elements JSON string data of the elements, see json_array_slice_t
+		/// @return A Container containing parsed data from JSON string
+		/// @throws daw::json::json_exception
+		template<typename JsonElement, typename Container, typename Constructor,
+		         typename String, auto... PolicyFlags>
+		[[nodiscard]] constexpr auto
+		from_json_array( json_array_slice_t, String &&elements,
+		                 options::parse_flags_t<PolicyFlags...> )
+		  -> std::enable_if_t<json_details::is_string_view_like_v<String>,
+		                      Container> {
+			static_assert(
+			  json_details::is_string_view_like_v<String>,
+			  "String type must have a be a contiguous range of Characters" );
+			static_assert(
+			  json_details::has_unnamed_default_type_mapping_v<JsonElement>,
+			  "Missing specialization of daw::json::json_data_contract for class "
+			  "mapping or specialization of daw::json::json_link_basic_type_map" );
+			using element_type = json_details::json_deduced_type<JsonElement>;
+			static_assert( traits::not_same_v<element_type, void>,
+			               "Unknown JsonElement type." );
+
+			using parser_t =
+			  json_base::json_array<JsonElement, Container, Constructor>;
+			using constructor_t = typename parser_t::constructor_t;
+
+			auto const rng = json_array_range<JsonElement, PolicyFlags...>(
+			  json_array_slice,
+			  daw::string_view( std::data( elements ), std::size( elements ) ) );
+			return constructor_t{ }( rng.begin( ), rng.end( ) );
+		}
+
+		/// @brief Parse a slice of an array's elements.  This allows starting at
+		/// any element boundary, e.g. from json_structural_index
+		/// @tparam JsonElement The type of each element in array.  Must be one of
+		/// the above json_XXX classes.  This version is checked
+		/// @tparam Container Container to store values in
+		/// @tparam Constructor Callable to construct Container with no arguments
+		/// @param elements JSON string data of the elements, see json_array_slice_t
+		/// @return A Container containing parsed data from JSON string
+		/// @throws daw::json::json_exception
+		template<typename JsonElement, typename Container, typename Constructor,
+		         typename String>
+		[[nodiscard]] constexpr auto from_json_array( json_array_slice_t,
+		                                              String &&elements )
+		  -> std::enable_if_t<json_details::is_string_view_like_v<String>,
+		                      Container> {
+
+			return from_json_array<JsonElement, Container, Constructor>(
+			  json_array_slice, DAW_FWD( elements ), options::parse_flags<> );
+		}
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
@@ -280,5 +280,43 @@ namespace daw::json {
 		[[nodiscard]] constexpr auto from_json_array( String &&json_data )
 		  -> std::enable_if_t<json_details::is_string_view_like_v<String>,
 		                      Container>;
+
+		/// @brief Parse a slice of an array's elements.  This allows starting at
+		/// any element boundary, e.g. from json_structural_index
+		/// @tparam JsonElement The type of each element in array.  Must be one of
+		/// the above json_XXX classes.  This version is checked
+		/// @tparam Container Container to store values in
+		/// @tparam Constructor Callable to construct Container with no arguments
+		/// @param elements JSON string data of the elements, see json_array_slice_t
+		/// @return A Container containing parsed data from JSON string
+		/// @throws daw::json::json_exception
+		template<typename JsonElement,
+		         typename Container =
+		           std::vector<json_details::from_json_result_t<JsonElement>>,
+		         typename Constructor = use_default, typename String,
+		         auto... PolicyFlags>
+		[[nodiscard]] constexpr auto
+		from_json_array( json_array_slice_t, String &&elements,
+		                 options::parse_flags_t<PolicyFlags...> )
+		  -> std::enable_if_t<json_details::is_string_view_like_v<String>,
+		                      Container>;
+
+		/// @brief Parse a slice of an array's elements.  This allows starting at
+		/// any element boundary, e.g. from json_structural_index
+		/// @tparam JsonElement The type of each element in array.  Must be one of
+		/// the above json_XXX classes.  This version is checked
+		/// @tparam Container Container to store values in
+		/// @tparam Constructor Callable to construct Container with no arguments
+		/// @param elements JSON string data of the elements, see json_array_slice_t
+		/// @return A Container containing parsed data from JSON string
+		/// @throws daw::json::json_exception
+		template<typename JsonElement,
+		         typename Container =
+		           std::vector<json_details::from_json_result_t<JsonElement>>,
+		         typename Constructor = use_default, typename String>
+		[[nodiscard]] constexpr auto from_json_array( json_array_slice_t,
+		                                              String &&elements )
+		  -> std::enable_if_t<json_details::is_string_view_like_v<String>,
+		                      Container>;
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
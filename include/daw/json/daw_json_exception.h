@@ -102,7 +102,9 @@ namespace daw::json {
 			ExpectedMemberNotFound,
 			ExpectedTokenNotFound,
 			UnexpectedJSONVariantType,
-			TrailingComma
+			TrailingComma,
+			MissingStringInternTable,
+			StringInternTableFull
 		};
 
 		constexpr std::string_view reason_message( ErrorReason er ) {
@@ -202,6 +204,10 @@ namespace daw::json {
 				return "Unexpected JSON Variant Type"sv;
 			case ErrorReason::TrailingComma:
 				return "Trailing comma"sv;
+			case ErrorReason::MissingStringInternTable:
+				return "No string intern table is in scope"sv;
+			case ErrorReason::StringInternTableFull:
+				return "The string intern table is full"sv;
 			}
 			DAW_UNREACHABLE( );
 		}
@@ -67,6 +67,12 @@ namespace daw::json {
 		class json_array_iterator {
 			using ParseState = BasicParsePolicy<
 			  options::details::make_parse_flags<PolicyFlags...>( ).value>;
+			/// Decoding a string in place writes an unescaped quote into the
+			/// buffer, a later scan of the element would end the string there
+			static_assert(
+			  not ParseState::is_in_situ_strings,
+			  "options::InSituStrings is only supported by from_json and "
+			  "from_json_array, an element can be read more than once" );
 			using CharT = typename ParseState::CharT;
 
 			static inline constexpr ParseState
@@ -125,6 +131,17 @@ namespace daw::json {
 				m_state.trim_left( );
 			}
 
+			/// @brief Iterate over a slice of an array's elements
+			/// @param elements The elements, starting at an element boundary, see
+			/// json_array_slice_t
+			inline constexpr explicit json_array_iterator( json_array_slice_t,
+			                                               daw::string_view elements )
+			  : m_state( ParseState( std::data( elements ),
+			                         daw::data_end( elements ) ) ) {
+
+				m_state.trim_left( );
+			}
+
 			/// @brief Parse the current element
 			/// @pre good( ) returns true
 			/// @return The parsed result of ParseElement
@@ -252,6 +269,12 @@ namespace daw::json {
 			                                     daw::string_view start_path )
 			  : m_first( jd, start_path ) {}
 
+			/// @brief A range over a slice of an array's elements, see
+			/// json_array_slice_t
+			constexpr explicit json_array_range( json_array_slice_t,
+			                                     daw::string_view elements )
+			  : m_first( json_array_slice, elements ) {}
+
 			/// @return first item in range
 			[[nodiscard]] inline constexpr iterator begin( ) const {
 				return m_first;
@@ -20,6 +20,7 @@
 #include <daw/daw_visit.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <string_view>
 #include <tuple>
 #include <type_traits>
@@ -518,6 +519,85 @@ namespace daw::json {
 		      Options, options::JsonRangeCheck::CheckForNarrowing>>,
 		  NullableType, Constructor>;
 
+		namespace json_base {
+			/// Scale - number of decimal places the integer T is scaled by
+			template<std::size_t Scale, typename T, json_options_t Options,
+			         typename Constructor>
+			struct json_fixed_point {
+				using i_am_a_json_type = void;
+				using wrapped_type = T;
+				static constexpr bool must_be_class_member = false;
+
+				static_assert( daw::is_integral_v<T> and daw::is_signed_v<T> and
+				                 sizeof( T ) <= sizeof( std::int64_t ),
+				               "json_fixed_point requires a signed integer type of "
+				               "at most 64 bits" );
+				static_assert( Scale <= daw::numeric_limits<T>::digits10,
+				               "Scale must be at most the number of digits of T" );
+
+				using constructor_t =
+				  std::conditional_t<std::is_same_v<use_default, Constructor>,
+				                     default_constructor<T>, Constructor>;
+				using parse_to_t =
+				  typename json_details::construction_result<constructor_t, T>::type;
+				using base_type = parse_to_t;
+
+				static constexpr JsonParseTypes expected_type = JsonParseTypes::Signed;
+				static constexpr std::size_t fixed_point_scale = Scale;
+
+				static constexpr options::LiteralAsStringOpt literal_as_string =
+				  json_details::get_bits_for<options::LiteralAsStringOpt>( number_opts,
+				                                                           Options );
+
+				static constexpr options::JsonRangeCheck range_check =
+				  options::JsonRangeCheck::CheckForNarrowing;
+
+				static constexpr JsonBaseParseTypes underlying_json_type =
+				  JsonBaseParseTypes::Number;
+
+				template<JSONNAMETYPE NewName>
+				using with_name = daw::json::json_fixed_point<NewName, Scale, T,
+				                                              Options, Constructor>;
+			};
+		} // namespace json_base
+
+		/**
+		 * The member is a decimal number that is parsed to, and serialized from,
+		 * an integer scaled by 10^Scale without using floating point.  e.g.
+		 * 123.4567 is 1234567 with a Scale of 4.  A value with more than Scale
+		 * non-zero decimal places, or that does not fit in T, is an error
+		 * @tparam Name name of json member
+		 * @tparam Scale number of decimal places
+		 * @tparam T signed integer type to pass to Constructor
+		 * @tparam LiteralAsString Could this number be embedded in a string
+		 * @tparam Constructor Callable used to construct result
+		 */
+		template<JSONNAMETYPE Name, std::size_t Scale, typename T,
+		         json_options_t Options, typename Constructor>
+		struct json_fixed_point
+		  : json_base::json_fixed_point<Scale, T, Options, Constructor> {
+
+			static constexpr daw::string_view name = Name;
+
+			using without_name =
+			  json_base::json_fixed_point<Scale, T, Options, Constructor>;
+		};
+
+		template<std::size_t Scale, typename T = std::int64_t,
+		         json_options_t Options = number_opts_def,
+		         typename Constructor = use_default>
+		using json_fixed_point_no_name =
+		  json_base::json_fixed_point<Scale, T, Options, Constructor>;
+
+		template<std::size_t Scale, typename T = std::optional<std::int64_t>,
+		         json_options_t Options = number_opts_def,
+		         JsonNullable NullableType = JsonNullable::Nullable,
+		         typename Constructor = use_default>
+		using json_fixed_point_null_no_name = json_base::json_nullable<
+		  T,
+		  json_base::json_fixed_point<Scale, json_details::unwrapped_t<T>, Options>,
+		  NullableType, Constructor>;
+
 		namespace json_base {
 			template<typename T, json_options_t Options, typename Constructor>
 			struct json_bool {
@@ -711,6 +791,154 @@ namespace daw::json {
 		  T, json_base::json_string<json_details::unwrapped_t<T>, Options>,
 		  NullableType, Constructor>;
 
+		namespace json_base {
+			/// String - A view of the string when it has no escapes, otherwise a
+			/// view of the decoded string in memory from the parse allocator
+			template<typename String, json_options_t Options, typename Constructor>
+			struct json_string_arena {
+				using i_am_a_json_type = void;
+				static constexpr bool must_be_class_member = false;
+				static constexpr bool is_arena_string = true;
+
+				using constructor_t =
+				  std::conditional_t<std::is_same_v<use_default, Constructor>,
+				                     default_constructor<String>, Constructor>;
+
+				static_assert(
+				  std::is_invocable_v<constructor_t, String>,
+				  "Constructor must support copy and/or move construction" );
+				using parse_to_t = std::invoke_result_t<constructor_t, String>;
+				using base_type = parse_to_t;
+
+				static constexpr JsonParseTypes expected_type =
+				  JsonParseTypes::StringEscaped;
+
+				static constexpr options::EightBitModes eight_bit_mode =
+				  json_details::get_bits_for<options::EightBitModes>( string_opts,
+				                                                      Options );
+
+				static constexpr JsonBaseParseTypes underlying_json_type =
+				  JsonBaseParseTypes::String;
+
+				template<JSONNAMETYPE NewName>
+				using with_name =
+				  daw::json::json_string_arena<NewName, String, Options, Constructor>;
+			};
+		} // namespace json_base
+
+		/**
+		 * Member is an escaped string that is a view.  A string without escapes
+		 * is a view of the document.  An escaped string is decoded into memory
+		 * from the allocator passed to from_json_alloc, which must outlive the
+		 * value and is never deallocated by the parser, e.g. an arena.  With
+		 * options::InSituStrings it is decoded in place instead
+		 * @tparam Name of json member
+		 * @tparam String result type constructed by Constructor
+		 * @tparam Constructor a callable taking as arguments ( char const *,
+		 * std::size_t )
+		 * @tparam EightBitMode Allow filtering of characters with the MSB set
+		 */
+		template<JSONNAMETYPE Name, typename String, json_options_t Options,
+		         typename Constructor>
+		struct json_string_arena
+		  : json_base::json_string_arena<String, Options, Constructor> {
+			static constexpr daw::string_view name = Name;
+
+			using without_name =
+			  json_base::json_string_arena<String, Options, Constructor>;
+		};
+
+		template<typename T = std::string_view,
+		         json_options_t Options = string_opts_def,
+		         typename Constructor = use_default>
+		using json_string_arena_no_name =
+		  json_base::json_string_arena<T, Options, Constructor>;
+
+		template<typename T = std::optional<std::string_view>,
+		         json_options_t Options = string_opts_def,
+		         JsonNullable NullableType = JsonNullable::Nullable,
+		         typename Constructor = use_default>
+		using json_string_arena_null_no_name = json_base::json_nullable<
+		  T, json_base::json_string_arena<json_details::unwrapped_t<T>, Options>,
+		  NullableType, Constructor>;
+
+		namespace json_base {
+			/// String - A view of the string stored in a string intern table
+			template<typename Table, typename String, json_options_t Options,
+			         typename Constructor>
+			struct json_string_interned {
+				using i_am_a_json_type = void;
+				static constexpr bool must_be_class_member = false;
+				static constexpr bool is_interned_string = true;
+				using intern_table_t = Table;
+
+				using constructor_t =
+				  std::conditional_t<std::is_same_v<use_default, Constructor>,
+				                     default_constructor<String>, Constructor>;
+
+				static_assert(
+				  std::is_invocable_v<constructor_t, String>,
+				  "Constructor must support copy and/or move construction" );
+				using parse_to_t = std::invoke_result_t<constructor_t, String>;
+				using base_type = parse_to_t;
+
+				static constexpr JsonParseTypes expected_type =
+				  JsonParseTypes::StringEscaped;
+
+				static constexpr options::EightBitModes eight_bit_mode =
+				  json_details::get_bits_for<options::EightBitModes>( string_opts,
+				                                                      Options );
+
+				static constexpr JsonBaseParseTypes underlying_json_type =
+				  JsonBaseParseTypes::String;
+
+				template<JSONNAMETYPE NewName>
+				using with_name =
+				  daw::json::json_string_interned<NewName, Table, String, Options,
+				                                  Constructor>;
+			};
+		} // namespace json_base
+
+		/**
+		 * Member is an escaped string that is interned in a string intern table,
+		 * so that equal values are stored once.  The table is the one made
+		 * current on the parsing thread with string_intern_scope
+		 * @tparam Name of json member
+		 * @tparam Table string_intern_table, concurrent_string_intern_table, or
+		 * a type with a std::string_view intern( std::string_view ) member
+		 * @tparam String result type constructed by Constructor
+		 * @tparam Constructor a callable taking as arguments ( char const *,
+		 * std::size_t )
+		 * @tparam EightBitMode Allow filtering of characters with the MSB set
+		 */
+		template<JSONNAMETYPE Name, typename Table, typename String,
+		         json_options_t Options, typename Constructor>
+		struct json_string_interned
+		  : json_base::json_string_interned<Table, String, Options, Constructor> {
+			static constexpr daw::string_view name = Name;
+
+			using without_name =
+			  json_base::json_string_interned<Table, String, Options, Constructor>;
+		};
+
+		template<typename Table = string_intern_table,
+		         typename T = std::string_view,
+		         json_options_t Options = string_opts_def,
+		         typename Constructor = use_default>
+		using json_string_interned_no_name =
+		  json_base::json_string_interned<Table, T, Options, Constructor>;
+
+		template<typename Table = string_intern_table,
+		         typename T = std::optional<std::string_view>,
+		         json_options_t Options = string_opts_def,
+		         JsonNullable NullableType = JsonNullable::Nullable,
+		         typename Constructor = use_default>
+		using json_string_interned_null_no_name = json_base::json_nullable<
+		  T,
+		  json_base::json_string_interned<Table, json_details::unwrapped_t<T>,
+		                                  Options>,
+		  NullableType, Constructor>;
+
 		namespace json_base {
 			template<typename T, typename Constructor>
 			struct json_date {
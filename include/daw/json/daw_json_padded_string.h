@@ -0,0 +1,124 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "impl/daw_json_exec_modes.h"
+
+#include <ciso646>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * A character buffer that is always followed by json_input_padding zero
+		 * bytes.  Documents held in one can be parsed with options::PaddedInput,
+		 * e.g. from_json<T>( std::string_view( buff ),
+		 * options::parse_flags<options::PaddedInput::yes> )
+		 */
+		class padded_string {
+			std::unique_ptr<char[]> m_data;
+			std::size_t m_size;
+
+			static std::unique_ptr<char[]> allocate( std::size_t size ) {
+				auto result = std::make_unique<char[]>( size + json_input_padding );
+				std::memset( result.get( ) + size, 0, json_input_padding );
+				return result;
+			}
+
+		public:
+			using value_type = char;
+			using size_type = std::size_t;
+			using iterator = char *;
+			using const_iterator = char const *;
+
+			padded_string( )
+			  : padded_string( std::size_t{ 0 } ) {}
+
+			/// @brief A buffer of size characters, to be filled by the caller.
+			/// The characters are not initialized but the padding is
+			explicit padded_string( std::size_t size )
+			  : m_data( allocate( size ) )
+			  , m_size( size ) {}
+
+			explicit padded_string( std::string_view str )
+			  : padded_string( str.size( ) ) {
+				if( not str.empty( ) ) {
+					std::memcpy( m_data.get( ), str.data( ), str.size( ) );
+				}
+			}
+
+			padded_string( padded_string && ) noexcept = default;
+			padded_string &operator=( padded_string && ) noexcept = default;
+
+			padded_string( padded_string const &other )
+			  : padded_string( std::string_view( other ) ) {}
+
+			padded_string &operator=( padded_string const &rhs ) {
+				if( this != &rhs ) {
+					*this = padded_string( rhs );
+				}
+				return *this;
+			}
+
+			~padded_string( ) = default;
+
+			/// @brief Change the size, keeping the first min( size, new_size )
+			/// characters
+			void resize( std::size_t new_size ) {
+				auto data = allocate( new_size );
+				std::memcpy( data.get( ), m_data.get( ),
+				             new_size < m_size ? new_size : m_size );
+				m_data = std::move( data );
+				m_size = new_size;
+			}
+
+			[[nodiscard]] char *data( ) {
+				return m_data.get( );
+			}
+
+			[[nodiscard]] char const *data( ) const {
+				return m_data.get( );
+			}
+
+			[[nodiscard]] std::size_t size( ) const {
+				return m_size;
+			}
+
+			[[nodiscard]] bool empty( ) const {
+				return m_size == 0;
+			}
+
+			[[nodiscard]] iterator begin( ) {
+				return data( );
+			}
+
+			[[nodiscard]] const_iterator begin( ) const {
+				return data( );
+			}
+
+			[[nodiscard]] iterator end( ) {
+				return data( ) + m_size;
+			}
+
+			[[nodiscard]] const_iterator end( ) const {
+				return data( ) + m_size;
+			}
+
+			/// @brief The document, without the padding
+			[[nodiscard]] operator std::string_view( ) const {
+				return std::string_view( data( ), m_size );
+			}
+		};
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
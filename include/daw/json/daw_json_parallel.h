@@ -0,0 +1,344 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+#include "daw_json_iterator.h"
+#include "impl/daw_json_structural_index.h"
+#include "impl/daw_json_work_stealing_pool.h"
+
+#include <daw/daw_string_view.h>
+
+#include <ciso646>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief Build the structural index of [first, last) on up to
+			/// thread_count threads.  Stage 1 runs in two passes over the chunks.
+			/// The first finds the quote parity of each chunk so that every chunk
+			/// knows if it starts inside of a string, escapes are resolved by
+			/// looking back at the backslashes before the chunk. The second finds
+			/// the structural characters.  Linking the brackets is sequential
+			inline structural_index
+			make_parallel_structural_index( char const *first, char const *last,
+			                                std::size_t thread_count ) {
+				if( first == nullptr or last <= first ) {
+					return structural_index( );
+				}
+				auto chunks = structural_index::make_chunks(
+				  static_cast<std::size_t>( last - first ), thread_count );
+				if( chunks.size( ) == 1 ) {
+					return structural_index( first, last );
+				}
+				// The last chunk's parity is not needed
+				auto parities = std::vector<std::future<bool>>( );
+				parities.reserve( chunks.size( ) - 1U );
+				for( std::size_t n = 0; n + 1U < chunks.size( ); ++n ) {
+					parities.push_back( std::async(
+					  std::launch::async, &structural_index::chunk_quote_parity, first,
+					  std::cref( chunks[n] ) ) );
+				}
+				bool in_string = false;
+				for( std::size_t n = 0; n < parities.size( ); ++n ) {
+					in_string = in_string != parities[n].get( );
+					chunks[n + 1U].starts_in_string = in_string;
+				}
+
+				auto indexers = std::vector<std::future<void>>( );
+				indexers.reserve( chunks.size( ) );
+				for( auto &c : chunks ) {
+					indexers.push_back( std::async( std::launch::async,
+					                                &structural_index::index_chunk,
+					                                first, std::ref( c ) ) );
+				}
+				for( auto &f : indexers ) {
+					f.get( );
+				}
+				return structural_index( first, last, DAW_MOVE( chunks ) );
+			}
+		} // namespace json_details
+
+		/// @brief A structural index of a whole document, built on multiple
+		/// threads.  It finds the element boundaries of large arrays so that the
+		/// elements can be parsed from any boundary, see json_array_slice_t.  The
+		/// document must outlive the index.  JSON with comments is not supported,
+		/// a `,`, `]`, or `"` inside of a comment is indexed as structural and the
+		/// boundaries found are wrong even when is_valid( ) is true
+		class json_structural_index {
+			daw::string_view m_doc;
+			json_details::structural_index m_index;
+
+		public:
+			/// @param json_doc The whole JSON document, without comments
+			/// @param thread_count The maximum number of threads to index on
+			explicit json_structural_index(
+			  daw::string_view json_doc,
+			  std::size_t thread_count = std::thread::hardware_concurrency( ) )
+			  : m_doc( json_doc )
+			  , m_index( json_details::make_parallel_structural_index(
+			      std::data( json_doc ), daw::data_end( json_doc ),
+			      thread_count ) ) {}
+
+			/// @param json_doc The whole JSON document
+			/// @param flags The parse flags the document will be parsed with.  The
+			/// comment policy must be PolicyCommentTypes::none
+			/// @param thread_count The maximum number of threads to index on
+			template<auto... PolicyFlags>
+			json_structural_index(
+			  daw::string_view json_doc, options::parse_flags_t<PolicyFlags...>,
+			  std::size_t thread_count = std::thread::hardware_concurrency( ) )
+			  : json_structural_index( json_doc, thread_count ) {
+				static_assert(
+				  json_details::get_bits_for<options::PolicyCommentTypes>(
+				    options::parse_flags_t<PolicyFlags...>::value ) ==
+				    options::PolicyCommentTypes::none,
+				  "The structural index does not support JSON with comments" );
+			}
+
+			/// @return false when the brackets or strings of the document are not
+			/// balanced
+			[[nodiscard]] bool is_valid( ) const {
+				return m_index.is_valid( );
+			}
+
+			/// @return The number of structural characters in the document
+			[[nodiscard]] std::size_t size( ) const {
+				return m_index.size( );
+			}
+
+			/// @return The underlying index.  Lookups do not modify it, so it can be
+			/// shared by parse states on many threads
+			[[nodiscard]] json_details::structural_index const &index( ) const {
+				return m_index;
+			}
+
+			/// @brief Find the separators of the array at member_path; the opening
+			/// bracket, the commas between the elements, and the closing bracket.
+			/// Element n is between result[n] and result[n + 1].  An empty array
+			/// has one empty element
+			/// @param member_path A dot separated path of member names to the array,
+			/// empty for the root value
+			/// @throws daw::json::json_exception when the path is not found, it is
+			/// not an array or the document is not balanced
+			[[nodiscard]] std::vector<char const *>
+			array_element_boundaries( std::string_view member_path = { } ) const {
+				daw_json_ensure( m_index.is_valid( ), ErrorReason::InvalidBracketing );
+				// Skip the values before the array with the index too
+				using ParseState =
+				  BasicParsePolicy<options::details::make_parse_flags<
+				    options::StructuralIndex::yes>( ).value>;
+				auto range = ParseState( std::data( m_doc ), daw::data_end( m_doc ) );
+				range.set_structural_index( m_index );
+				range.trim_left_checked( );
+				if( range.has_more( ) and not member_path.empty( ) ) {
+					daw_json_ensure(
+					  json_details::find_range2(
+					    range, { std::data( member_path ), std::size( member_path ) } ),
+					  ErrorReason::JSONPathNotFound );
+				}
+				daw_json_ensure( range.has_more( ) and range.front( ) == '[',
+				                 ErrorReason::InvalidArrayStart );
+				auto const open = m_index.find( range.first );
+				daw_json_ensure( open != json_details::structural_index::npos,
+				                 ErrorReason::InvalidArrayStart );
+				return m_index.array_boundaries( open );
+			}
+
+			/// @brief Split the elements between boundaries, as returned by
+			/// array_element_boundaries, into at most num_partitions slices of about
+			/// the same size in bytes
+			[[nodiscard]] static std::vector<daw::string_view>
+			partition_array_elements( std::vector<char const *> const &boundaries,
+			                          std::size_t num_partitions ) {
+				char const *const first = boundaries.front( ) + 1;
+				char const *const last = boundaries.back( ) + 1;
+				if( num_partitions <= 1 ) {
+					return { daw::string_view( first, last ) };
+				}
+				// Round up so that there are at most num_partitions slices
+				auto const approx_segsize =
+				  ( static_cast<std::size_t>( last - first ) + num_partitions - 1U ) /
+				  num_partitions;
+				auto result = std::vector<daw::string_view>( );
+				result.reserve( num_partitions );
+				char const *seg_first = first;
+				for( std::size_t n = 1; n < boundaries.size( ); ++n ) {
+					char const *const sep = boundaries[n] + 1;
+					if( n + 1U == boundaries.size( ) or
+					    static_cast<std::size_t>( sep - seg_first ) >= approx_segsize ) {
+						result.emplace_back( seg_first, sep );
+						seg_first = sep;
+					}
+				}
+				return result;
+			}
+
+			/// @brief Split the elements of the array at member_path into at most
+			/// num_partitions slices of about the same size in bytes.  Each can be
+			/// passed to from_json_array or json_array_range with json_array_slice
+			[[nodiscard]] std::vector<daw::string_view>
+			partition_array_elements( std::size_t num_partitions,
+			                          std::string_view member_path = { } ) const {
+				return partition_array_elements(
+				  array_element_boundaries( member_path ), num_partitions );
+			}
+
+			/// @brief Split the array at member_path into at most num_partitions
+			/// ranges of about the same size in bytes.
+			/// @tparam JsonElement The type of each element in array
+			template<typename JsonElement, auto... PolicyFlags>
+			[[nodiscard]] std::vector<json_array_range<JsonElement, PolicyFlags...>>
+			partition_array( std::size_t num_partitions,
+			                 std::string_view member_path = { } ) const {
+				auto result =
+				  std::vector<json_array_range<JsonElement, PolicyFlags...>>( );
+				for( auto const &elements :
+				     partition_array_elements( num_partitions, member_path ) ) {
+					result.emplace_back( json_array_slice, elements );
+				}
+				return result;
+			}
+		};
+
+		namespace json_details {
+			template<typename Container>
+			using container_reserve_test =
+			  decltype( std::declval<Container &>( ).reserve( std::size_t{ } ) );
+
+			/// @brief Tasks per thread for from_json_array_parallel.  More tasks than
+			/// threads lets the pool balance elements that are slower to parse
+			inline constexpr std::size_t parallel_tasks_per_thread = 4;
+		} // namespace json_details
+
+		/// @brief Parse JSON data where the root item is an array on multiple
+		/// threads.  The element boundaries are found with json_structural_index,
+		/// the elements are split into slices of about the same size and parsed on
+		/// a work stealing pool into a Container each.  These are spliced in order.
+		/// If the document's structure is invalid it is parsed with from_json_array
+		/// to report the error.  With a comment policy the document is parsed on
+		/// one thread with from_json_array, as the index does not support comments
+		/// @tparam JsonElement The type of each element in array.  Must be one of
+		/// the above json_XXX classes.  This version is checked
+		/// @tparam Container Container to store values in.  It must support
+		/// insert( end, first, last )
+		/// @tparam Constructor Callable to construct Container with no arguments
+		/// @param json_data JSON string data containing array
+		/// @param thread_count The maximum number of threads to use, 0 for
+		/// std::thread::hardware_concurrency( )
+		/// @return A Container containing parsed data from JSON string
+		/// @throws daw::json::json_exception
+		template<typename JsonElement,
+		         typename Container =
+		           std::vector<json_details::from_json_result_t<JsonElement>>,
+		         typename Constructor = use_default, typename String,
+		         auto... PolicyFlags>
+		[[nodiscard]] auto
+		from_json_array_parallel( String &&json_data,
+		                          options::parse_flags_t<PolicyFlags...> flags,
+		                          std::size_t thread_count = 0 )
+		  -> std::enable_if_t<json_details::is_string_view_like_v<String>,
+		                      Container> {
+			daw_json_ensure( std::size( json_data ) != 0,
+			                 ErrorReason::EmptyJSONDocument );
+			daw_json_ensure( std::data( json_data ) != nullptr,
+			                 ErrorReason::EmptyJSONPath );
+			using ParseState =
+			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			if constexpr( not std::is_same_v<typename ParseState::CommentPolicy,
+			                                 NoCommentSkippingPolicy> ) {
+				// The structural index does not know about comments, a `,` or `]` in
+				// one would be found as an element boundary
+				(void)thread_count;
+				return from_json_array<JsonElement, Container, Constructor>(
+				  DAW_FWD( json_data ), flags );
+			} else {
+				if( thread_count == 0 ) {
+					thread_count = std::thread::hardware_concurrency( );
+				}
+				if( thread_count <= 1 ) {
+					return from_json_array<JsonElement, Container, Constructor>(
+					  DAW_FWD( json_data ), flags );
+				}
+				auto const doc =
+				  daw::string_view( std::data( json_data ), std::size( json_data ) );
+				auto const index = json_structural_index( doc, flags, thread_count );
+				if( not index.is_valid( ) ) {
+					return from_json_array<JsonElement, Container, Constructor>( doc,
+					                                                             flags );
+				}
+				auto const boundaries = index.array_element_boundaries( );
+				if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
+					auto tail =
+					  ParseState( boundaries.back( ) + 1, daw::data_end( doc ) );
+					tail.trim_left( );
+					daw_json_ensure( tail.empty( ), ErrorReason::InvalidEndOfValue,
+					                 tail );
+				}
+
+				auto const slices = json_structural_index::partition_array_elements(
+				  boundaries, thread_count * json_details::parallel_tasks_per_thread );
+				auto parts = std::vector<std::optional<Container>>( slices.size( ) );
+				json_details::work_stealing_pool::run(
+				  slices.size( ), thread_count, [&]( std::size_t n ) {
+					  parts[n] = from_json_array<JsonElement, Container, Constructor>(
+					    json_array_slice, slices[n], flags );
+				  } );
+
+				auto result = DAW_MOVE( *parts.front( ) );
+				if constexpr( daw::is_detected_v<json_details::container_reserve_test,
+				                                 Container> ) {
+					std::size_t total = 0;
+					for( auto const &part : parts ) {
+						total += std::size( *part );
+					}
+					result.reserve( total );
+				}
+				for( std::size_t n = 1; n < parts.size( ); ++n ) {
+					result.insert( std::end( result ),
+					               std::make_move_iterator( std::begin( *parts[n] ) ),
+					               std::make_move_iterator( std::end( *parts[n] ) ) );
+					parts[n].reset( );
+				}
+				return result;
+			}
+		}
+
+		/// @brief Parse JSON data where the root item is an array on multiple
+		/// threads.  See the overload taking parse_flags
+		/// @tparam JsonElement The type of each element in array
+		/// @param json_data JSON string data containing array
+		/// @param thread_count The maximum number of threads to use, 0 for
+		/// std::thread::hardware_concurrency( )
+		/// @return A Container containing parsed data from JSON string
+		/// @throws daw::json::json_exception
+		template<typename JsonElement,
+		         typename Container =
+		           std::vector<json_details::from_json_result_t<JsonElement>>,
+		         typename Constructor = use_default, typename String>
+		[[nodiscard]] auto from_json_array_parallel( String &&json_data,
+		                                             std::size_t thread_count = 0 )
+		  -> std::enable_if_t<json_details::is_string_view_like_v<String>,
+		                      Container> {
+			return from_json_array_parallel<JsonElement, Container, Constructor>(
+			  DAW_FWD( json_data ), options::parse_flags<>, thread_count );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -30,8 +30,16 @@ namespace daw::json {
 					/// methods
 					runtime,
 					/// @brief *testing* Allow code paths that use SIMD intrinsics
-					simd
-				}; // 2bits
+					simd,
+					/// @brief *testing* Allow code paths that use 256bit AVX2
+					/// intrinsics.  Requires DAW_ALLOW_AVX2, otherwise it is the same as
+					/// simd
+					avx2,
+					/// @brief *testing* Select the SIMD code paths at runtime based on
+					/// the CPU's supported instruction sets.  Does not require
+					/// DAW_ALLOW_SSE42 or DAW_ALLOW_AVX2
+					dispatch
+				}; // 3bits
 
 				///
 				/// @brief Input is a zero terminated string.  If this cannot be
@@ -149,6 +157,94 @@ namespace daw::json {
 				/// default: no
 				///
 				enum class ExcludeSpecialEscapes : unsigned { no, yes }; // 1bit
+				///
+				/// @brief Build an index of the structural characters of the document
+				/// before parsing.  Skipping classes, arrays, and strings then jumps
+				/// to the closing character instead of scanning for it.  This helps
+				/// large documents where most of the members are skipped or found
+				/// out of order and costs an extra pass and memory otherwise.  It is
+				/// not used with comment policies.
+				///
+				/// default: no
+				///
+				enum class StructuralIndex : unsigned { no, yes }; // 1bit
+
+				///
+				/// @brief How the member names found in the document are matched to
+				/// the mapped members.  hash compares a hash of the name, with a
+				/// perfect hash for classes with many members.  length_prefix
+				/// switches on the length of the name and compares its first 16 bytes
+				/// as two 8 byte words, this skips hashing and helps with short names.
+				///
+				/// default: hash
+				///
+				enum class MemberNameLookup : unsigned { hash, length_prefix }; // 1bit
+
+				///
+				/// @brief The documents have their members in the same order as the
+				/// mapping.  Each member name is compared with the expected name
+				/// directly, and only a mismatch uses the name lookup.  When the input
+				/// is unchecked, names that are not nullable are skipped without
+				/// comparing.  See also, the expect_ordered_members trait to set this
+				/// for a single class
+				///
+				/// default: no
+				///
+				enum class ExpectOrderedMembers : unsigned { no, yes }; // 1bit
+
+				///
+				/// @brief Learn the order of the members in the documents of each
+				/// class, per thread.  Members are parsed in the order they are in the
+				/// document, each name is compared with the member that was in that
+				/// position last time, and the class is constructed after.  Members
+				/// out of the mapping order are not skipped and parsed again, and a
+				/// name that is not where it was last time uses the name lookup. Not
+				/// used in constant expressions or for classes that must be
+				/// constructed in place.  See also, the learn_member_order trait to
+				/// set this for a single class
+				///
+				/// default: no
+				///
+				enum class LearnMemberOrder : unsigned { no, yes }; // 1bit
+
+				///
+				/// @brief The caller guarantees that json_input_padding readable bytes
+				/// follow the document, e.g. by using padded_string.  The SIMD exec
+				/// modes then search with full width loads to the end of the document
+				/// instead of finishing with a copy or a byte loop.  The padding may
+				/// hold any value.
+				///
+				/// default: no
+				///
+				enum class PaddedInput : unsigned { no, yes }; // 1bit
+
+				///
+				/// @brief Check that the string values, and optionally the member
+				/// names, are valid UTF-8 while they are parsed.  Overlong encodings,
+				/// surrogates and code points past U+10FFFF are errors.  Each string
+				/// is checked in a separate pass after it is skipped or copied, while
+				/// it is still in cache.  The SIMD exec modes check a block at a time
+				///
+				/// default: no
+				///
+				enum class ValidateUTF8 : unsigned {
+					/// @brief Strings are not checked
+					no,
+					/// @brief Check string values
+					values,
+					/// @brief Check string values and member names
+					values_and_names
+				}; // 2bits
+
+				///
+				/// @brief Decode escaped strings in place in the caller's buffer.
+				/// json_string_raw members, and std::string_view members, then see the
+				/// decoded text without an allocation.  The buffer must be mutable, and
+				/// after the parse it no longer holds the original document
+				///
+				/// default: no
+				///
+				enum class InSituStrings : unsigned { no, yes }; // 1bit
 			} // namespace parser_options
 		}   // namespace options
 	}     // namespace DAW_JSON_VER
@@ -127,7 +127,11 @@ namespace daw::json {
 					out_it.add_indent( );
 					out_it.next_member( );
 				}
-				out_it = utils::output_kv( out_it, R"("type")", R"("integer")" );
+				if constexpr( json_details::is_fixed_point_v<JsonMember> ) {
+					out_it = utils::output_kv( out_it, R"("type")", R"("number")" );
+				} else {
+					out_it = utils::output_kv( out_it, R"("type")", R"("integer")" );
+				}
 				if constexpr( not is_root ) {
 					out_it.del_indent( );
 				}
@@ -0,0 +1,259 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_string_intern_fwd.h"
+#include "impl/daw_murmur3.h"
+
+#include <algorithm>
+#include <atomic>
+#include <ciso646>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			[[nodiscard]] inline std::uint32_t
+			intern_hash( std::string_view value ) {
+				return static_cast<std::uint32_t>( daw::murmur3_32( value ) );
+			}
+
+			[[nodiscard]] inline std::size_t
+			intern_capacity( std::size_t capacity ) {
+				std::size_t result = 16;
+				while( result < capacity ) {
+					result *= 2;
+				}
+				return result;
+			}
+		} // namespace json_details
+
+		/***
+		 * A string intern table for one thread, e.g. for the duration of a
+		 * parse.  Equal strings are stored once and intern returns a view of the
+		 * stored string.  The views are valid until the table is destroyed, and
+		 * equal values have the same data( ), so it can be used as an id
+		 */
+		class string_intern_table {
+			struct slot {
+				std::string_view value{ };
+				std::uint32_t hash = 0;
+			};
+			static constexpr std::size_t block_size = 4096U;
+
+			std::vector<slot> m_slots;
+			std::vector<std::unique_ptr<char[]>> m_blocks{ };
+			char *m_free = nullptr;
+			std::size_t m_free_size = 0;
+			std::size_t m_size = 0;
+
+			char *store( std::string_view value ) {
+				if( m_free_size < value.size( ) ) {
+					auto const sz = std::max( block_size, value.size( ) );
+					m_blocks.push_back( std::make_unique<char[]>( sz ) );
+					m_free = m_blocks.back( ).get( );
+					m_free_size = sz;
+				}
+				char *const result = m_free;
+				std::memcpy( result, value.data( ), value.size( ) );
+				m_free += value.size( );
+				m_free_size -= value.size( );
+				return result;
+			}
+
+			void grow( ) {
+				auto slots = std::vector<slot>( m_slots.size( ) * 2U );
+				std::size_t const mask = slots.size( ) - 1U;
+				for( auto const &s : m_slots ) {
+					if( s.value.data( ) == nullptr ) {
+						continue;
+					}
+					std::size_t idx = s.hash & mask;
+					while( slots[idx].value.data( ) != nullptr ) {
+						idx = ( idx + 1U ) & mask;
+					}
+					slots[idx] = s;
+				}
+				m_slots = std::move( slots );
+			}
+
+		public:
+			/// @param capacity The number of distinct strings expected, the table
+			/// grows past it
+			explicit string_intern_table( std::size_t capacity = 256U )
+			  : m_slots( json_details::intern_capacity( capacity * 2U ) ) {}
+
+			/// @return A view of the stored string equal to value
+			[[nodiscard]] std::string_view intern( std::string_view value ) {
+				if( value.empty( ) ) {
+					return { };
+				}
+				std::uint32_t const hash = json_details::intern_hash( value );
+				std::size_t const mask = m_slots.size( ) - 1U;
+				std::size_t idx = hash & mask;
+				while( m_slots[idx].value.data( ) != nullptr ) {
+					if( m_slots[idx].hash == hash and m_slots[idx].value == value ) {
+						return m_slots[idx].value;
+					}
+					idx = ( idx + 1U ) & mask;
+				}
+				auto const result = std::string_view( store( value ), value.size( ) );
+				m_slots[idx] = slot{ result, hash };
+				if( ++m_size * 2U > m_slots.size( ) ) {
+					grow( );
+				}
+				return result;
+			}
+
+			/// @return The number of distinct strings stored
+			[[nodiscard]] std::size_t size( ) const {
+				return m_size;
+			}
+		};
+
+		/***
+		 * A string intern table that can be shared by the threads of a parse,
+		 * e.g. those parsing the ranges from partition_jsonl_document.  Lookups
+		 * and inserts are lock free.  The number of slots is fixed at twice the
+		 * capacity, rounded up to a power of two and at least 16.  Interning more
+		 * distinct strings than there are slots is an error, and lookups slow
+		 * down as the table fills.  The views are valid until the table is
+		 * destroyed, and equal values have the same data( )
+		 */
+		class concurrent_string_intern_table {
+			struct entry {
+				std::uint32_t hash;
+				std::size_t size;
+
+				[[nodiscard]] char *data( ) {
+					return reinterpret_cast<char *>( this + 1 );
+				}
+
+				[[nodiscard]] std::string_view value( ) {
+					return std::string_view( data( ), size );
+				}
+			};
+
+			std::unique_ptr<std::atomic<entry *>[]> m_slots;
+			std::size_t m_mask;
+			std::atomic<std::size_t> m_size{ 0 };
+
+			static entry *make_entry( std::string_view value, std::uint32_t hash ) {
+				void *const mem = ::operator new( sizeof( entry ) + value.size( ) );
+				auto *const result = new( mem ) entry{ hash, value.size( ) };
+				std::memcpy( result->data( ), value.data( ), value.size( ) );
+				return result;
+			}
+
+			static void destroy_entry( entry *e ) {
+				e->~entry( );
+				::operator delete( static_cast<void *>( e ) );
+			}
+
+		public:
+			/// @param capacity The number of distinct strings expected.  The
+			/// table has room for at least twice as many
+			explicit concurrent_string_intern_table( std::size_t capacity = 4096U )
+			  : m_slots( std::make_unique<std::atomic<entry *>[]>(
+			      json_details::intern_capacity( capacity * 2U ) ) )
+			  , m_mask( json_details::intern_capacity( capacity * 2U ) - 1U ) {
+				for( std::size_t n = 0; n <= m_mask; ++n ) {
+					m_slots[n].store( nullptr, std::memory_order_relaxed );
+				}
+			}
+
+			concurrent_string_intern_table(
+			  concurrent_string_intern_table const & ) = delete;
+			concurrent_string_intern_table &
+			operator=( concurrent_string_intern_table const & ) = delete;
+
+			~concurrent_string_intern_table( ) {
+				for( std::size_t n = 0; n <= m_mask; ++n ) {
+					if( entry *e = m_slots[n].load( std::memory_order_relaxed ) ) {
+						destroy_entry( e );
+					}
+				}
+			}
+
+			/// @return A view of the stored string equal to value
+			/// @throws json_exception when the table is full
+			[[nodiscard]] std::string_view intern( std::string_view value ) {
+				if( value.empty( ) ) {
+					return { };
+				}
+				std::uint32_t const hash = json_details::intern_hash( value );
+				entry *created = nullptr;
+				std::size_t idx = hash & m_mask;
+				for( std::size_t probes = 0; probes <= m_mask; ++probes ) {
+					entry *current = m_slots[idx].load( std::memory_order_acquire );
+					if( current == nullptr ) {
+						if( created == nullptr ) {
+							created = make_entry( value, hash );
+						}
+						if( m_slots[idx].compare_exchange_strong(
+						      current, created, std::memory_order_acq_rel,
+						      std::memory_order_acquire ) ) {
+							m_size.fetch_add( 1, std::memory_order_relaxed );
+							return created->value( );
+						}
+						// Another thread filled the slot, current is its entry
+					}
+					if( current->hash == hash and current->value( ) == value ) {
+						if( created != nullptr ) {
+							destroy_entry( created );
+						}
+						return current->value( );
+					}
+					idx = ( idx + 1U ) & m_mask;
+				}
+				if( created != nullptr ) {
+					destroy_entry( created );
+				}
+				daw_json_error( ErrorReason::StringInternTableFull );
+			}
+
+			/// @return The number of distinct strings stored
+			[[nodiscard]] std::size_t size( ) const {
+				return m_size.load( std::memory_order_relaxed );
+			}
+		};
+
+		/***
+		 * Make table the one used by json_string_interned members parsed on this
+		 * thread, until the scope ends.  Each thread parsing with a shared
+		 * concurrent_string_intern_table needs its own scope
+		 */
+		template<typename Table>
+		class string_intern_scope {
+			Table *m_previous;
+
+		public:
+			explicit string_intern_scope( Table &table ) noexcept
+			  : m_previous( std::exchange(
+			      json_details::current_string_intern_table<Table>, &table ) ) {}
+
+			string_intern_scope( string_intern_scope const & ) = delete;
+			string_intern_scope &operator=( string_intern_scope const & ) = delete;
+
+			~string_intern_scope( ) {
+				json_details::current_string_intern_table<Table> = m_previous;
+			}
+		};
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,129 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+#include "impl/daw_json_validator.h"
+
+#include <ciso646>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief Check that json_data is a syntactically valid JSON document,
+		/// without parsing it into a type.  The SIMD exec modes in flags skip
+		/// string characters and whitespace a block at a time.  Comments are not
+		/// accepted
+		/// @param json_data The JSON document
+		/// @param check_utf8 Require the strings to be valid UTF-8
+		/// @return The result, with the reason and position of the first error
+		/// when the document is not valid
+		template<auto... PolicyFlags>
+		[[nodiscard]] json_validation_result
+		validate_json( std::string_view json_data,
+		               options::parse_flags_t<PolicyFlags...>,
+		               bool check_utf8 = false ) {
+			using exec_tag_t = typename BasicParsePolicy<
+			  options::parse_flags_t<PolicyFlags...>::value>::exec_tag_t;
+			auto const *const first = std::data( json_data );
+			auto const *const last = first + std::size( json_data );
+			if( check_utf8 ) {
+				return json_details::validate_json_impl<exec_tag_t, true>( first,
+				                                                           last );
+			}
+			return json_details::validate_json_impl<exec_tag_t, false>( first,
+			                                                            last );
+		}
+
+		/// @brief Check that json_data is a syntactically valid JSON document,
+		/// without parsing it into a type.  This uses the SIMD exec mode when it
+		/// is available
+		/// @param json_data The JSON document
+		/// @param check_utf8 Require the strings to be valid UTF-8
+		/// @return The result, with the reason and position of the first error
+		/// when the document is not valid
+		[[nodiscard]] inline json_validation_result
+		validate_json( std::string_view json_data, bool check_utf8 = false ) {
+			return validate_json(
+			  json_data, options::parse_flags<options::ExecModeTypes::simd>,
+			  check_utf8 );
+		}
+
+		namespace json_details {
+			/// @brief The flags from_json_validated parses with after validate_json.
+			/// parse_options ors the option bits together, so the options are
+			/// replaced with set_bits instead of appended
+			template<auto... PolicyFlags>
+			inline constexpr json_options_t from_json_validated_flags_v =
+			  set_bits( options::parse_flags_t<PolicyFlags...>::value,
+			            options::CheckedParseMode::no, options::ValidateUTF8::no );
+		} // namespace json_details
+
+		/// @brief Validate json_data with validate_json and then parse it with
+		/// CheckedParseMode::no.  For untrusted input this is one fast pass over
+		/// the syntax followed by a parse without the checks.  Only the syntax
+		/// is validated, so mapping and type errors, e.g. a missing member or a
+		/// value of the wrong type, may go undetected and give unspecified
+		/// values.  Use from_json when the document may not match JsonMember.
+		/// With options::ValidateUTF8 all of the strings are checked by
+		/// validate_json instead of during the parse
+		/// @tparam JsonMember The type of the item being parsed
+		/// @param json_data JSON string data
+		/// @param flags The parse options, CheckedParseMode is set to no
+		/// @return A reified JsonMember constructed from JSON data
+		/// @throws daw::json::json_exception when the document is not valid
+		template<typename JsonMember, bool KnownBounds = false, typename String,
+		         auto... PolicyFlags>
+		[[nodiscard]] auto
+		from_json_validated( String &&json_data,
+		                     options::parse_flags_t<PolicyFlags...> flags ) {
+			static_assert(
+			  json_details::is_string_view_like_v<String>,
+			  "String type must have a be a contiguous range of Characters" );
+			using ParseState =
+			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			static_assert(
+			  std::is_same_v<typename ParseState::CommentPolicy,
+			                 NoCommentSkippingPolicy>,
+			  "The validator does not accept comments" );
+			daw_json_ensure( std::data( json_data ) != nullptr,
+			                 ErrorReason::EmptyJSONPath );
+			auto const doc =
+			  std::string_view( std::data( json_data ), std::size( json_data ) );
+			auto const result =
+			  validate_json( doc, flags, ParseState::is_validate_utf8_values );
+			if( not result ) {
+				auto const location = ParseState(
+				  std::data( doc ) + result.position, std::data( doc ) + doc.size( ) );
+				daw_json_error( result.reason, location );
+			}
+			return json_details::from_json_with_flags<
+			  JsonMember, KnownBounds,
+			  json_details::from_json_validated_flags_v<PolicyFlags...>>(
+			  DAW_FWD( json_data ) );
+		}
+
+		/// @brief Validate json_data with validate_json and then parse it with
+		/// CheckedParseMode::no and the SIMD exec mode
+		/// @tparam JsonMember The type of the item being parsed
+		/// @param json_data JSON string data
+		/// @return A reified JsonMember constructed from JSON data
+		/// @throws daw::json::json_exception when the document is not valid
+		template<typename JsonMember, bool KnownBounds = false, typename String>
+		[[nodiscard]] auto from_json_validated( String &&json_data ) {
+			return from_json_validated<JsonMember, KnownBounds>(
+			  DAW_FWD( json_data ),
+			  options::parse_flags<options::ExecModeTypes::simd> );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
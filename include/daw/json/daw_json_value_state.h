@@ -70,9 +70,14 @@ namespace daw::json {
 			  , hash_value( daw::name_hash<false>( name ) ) {}
 		};
 
+		/// @brief basic_stateful_json_value searches the members it has found
+		/// linearly until there are this many, and then through a hash table
+		inline constexpr std::size_t stateful_json_value_index_threshold = 16;
+
 		/**
 		 * Maintains the parse positions of a json_value so that you pay the lookup
-		 * costs once
+		 * costs once.  Once many members are known, lookups by name use an open
+		 * addressing table of the member name hashes
 		 * @tparam ParseState see IteratorRange
 		 */
 		template<json_options_t PolicyFlags = json_details::default_policy_flag,
@@ -84,6 +89,78 @@ namespace daw::json {
 			std::vector<
 			  json_details::basic_stateful_json_value_state<PolicyFlags, Allocator>>
 			  m_locs{ };
+			// Position + 1 of the member in m_locs, 0 is an empty slot.  The size is
+			// a power of 2 and at most half of the slots are used
+			std::vector<std::size_t> m_index{ };
+
+			[[nodiscard]] constexpr std::size_t
+			index_slot( daw::UInt32 hash ) const {
+				return static_cast<std::size_t>( hash ) & ( std::size( m_index ) - 1U );
+			}
+
+			// The first member with a name is the one found, as with the linear
+			// search, so later duplicates are not added
+			constexpr void index_insert( std::size_t pos ) {
+				auto const &loc = m_locs[pos];
+				std::size_t slot = index_slot( loc.hash_value );
+				while( m_index[slot] != 0 ) {
+					if( m_locs[m_index[slot] - 1U].is_match( loc.name, loc.hash_value ) ) {
+						return;
+					}
+					slot = ( slot + 1U ) & ( std::size( m_index ) - 1U );
+				}
+				m_index[slot] = pos + 1U;
+			}
+
+			constexpr void rebuild_index( std::size_t member_count ) {
+				std::size_t slot_count = 2U * stateful_json_value_index_threshold;
+				while( slot_count < 2U * member_count ) {
+					slot_count *= 2U;
+				}
+				m_index.assign( slot_count, 0 );
+				for( std::size_t pos = 0; pos < std::size( m_locs ); ++pos ) {
+					index_insert( pos );
+				}
+			}
+
+			template<typename Iterator>
+			constexpr auto const &add_location( daw::string_view name,
+			                                    Iterator const &it ) {
+				m_locs.emplace_back( name, it );
+				std::size_t const pos = std::size( m_locs ) - 1U;
+				if( m_index.empty( ) ) {
+					if( std::size( m_locs ) >= stateful_json_value_index_threshold ) {
+						rebuild_index( std::size( m_locs ) );
+					}
+				} else if( 2U * std::size( m_locs ) > std::size( m_index ) ) {
+					rebuild_index( std::size( m_locs ) );
+				} else {
+					index_insert( pos );
+				}
+				return m_locs[pos];
+			}
+
+			[[nodiscard]] constexpr std::size_t
+			find_known( json_member_name const &member ) const {
+				std::size_t const Sz = std::size( m_locs );
+				if( m_index.empty( ) ) {
+					for( std::size_t pos = 0; pos < Sz; ++pos ) {
+						if( m_locs[pos].is_match( member.name, member.hash_value ) ) {
+							return pos;
+						}
+					}
+					return Sz;
+				}
+				std::size_t slot = index_slot( member.hash_value );
+				while( m_index[slot] != 0 ) {
+					std::size_t const pos = m_index[slot] - 1U;
+					if( m_locs[pos].is_match( member.name, member.hash_value ) ) {
+						return pos;
+					}
+					slot = ( slot + 1U ) & ( std::size( m_index ) - 1U );
+				}
+				return Sz;
+			}
 
 			/***
 			 * Move parser until member name matches key if needed
@@ -91,12 +168,9 @@ namespace daw::json {
 			 * @return position of member or size
 			 */
 			[[nodiscard]] constexpr std::size_t move_to( json_member_name member ) {
-				std::size_t pos = 0;
-				std::size_t const Sz = std::size( m_locs );
-				for( ; pos < Sz; ++pos ) {
-					if( m_locs[pos].is_match( member.name, member.hash_value ) ) {
-						return pos;
-					}
+				std::size_t pos = find_known( member );
+				if( pos < std::size( m_locs ) ) {
+					return pos;
 				}
 
 				auto it = [&] {
@@ -111,7 +185,7 @@ namespace daw::json {
 				while( it != last ) {
 					auto name = it.name( );
 					daw_json_assert_weak( name, ErrorReason::MissingMemberName );
-					auto const &new_loc = m_locs.emplace_back(
+					auto const &new_loc = add_location(
 					  daw::string_view( std::data( *name ), std::size( *name ) ), it );
 					if( new_loc.is_match( member.name ) ) {
 						return pos;
@@ -144,10 +218,10 @@ namespace daw::json {
 				while( it != last ) {
 					auto name = it.name( );
 					if( name ) {
-						m_locs.emplace_back(
+						(void)add_location(
 						  daw::string_view( std::data( *name ), std::size( *name ) ), it );
 					} else {
-						m_locs.emplace_back( daw::string_view( ), it );
+						(void)add_location( daw::string_view( ), it );
 					}
 					if( pos == index ) {
 						return pos;
@@ -186,6 +260,20 @@ namespace daw::json {
 			constexpr void reset( basic_json_value<PolicyFlags, Allocator> val ) {
 				m_value = DAW_MOVE( val );
 				m_locs.clear( );
+				m_index.clear( );
+			}
+
+			/// @brief Find all of the members now and index them by name.  Later
+			/// lookups by name are O(1), use this when the value is queried many
+			/// times
+			/// @return number of members/elements
+			///
+			std::size_t index_members( ) {
+				std::size_t const result = size( );
+				if( m_index.empty( ) and not m_locs.empty( ) ) {
+					rebuild_index( std::size( m_locs ) );
+				}
+				return result;
 			}
 
 			/// @brief Create a basic_json_member for the named member
@@ -299,14 +387,14 @@ namespace daw::json {
 							return { };
 						}
 						sz -= static_cast<std::size_t>( index );
-						return std::string_view( std::data( m_locs[sz].name( ) ),
-						                         std::size( m_locs[sz].name( ) ) );
+						return std::string_view( std::data( m_locs[sz].name ),
+						                         std::size( m_locs[sz].name ) );
 					}
 				}
 				std::size_t pos = move_to( static_cast<std::size_t>( index ) );
 				if( pos < std::size( m_locs ) ) {
-					return std::string_view( std::data( m_locs[pos].name( ) ),
-					                         std::size( m_locs[pos].name( ) ) );
+					return std::string_view( std::data( m_locs[pos].name ),
+					                         std::size( m_locs[pos].name ) );
 				}
 				return { };
 			}
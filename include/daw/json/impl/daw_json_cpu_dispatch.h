@@ -0,0 +1,209 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "daw_json_exec_modes.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_likely.h>
+
+#include <ciso646>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#if defined( __x86_64__ ) or defined( _M_X64 )
+#define DAW_JSON_HAS_CPU_DISPATCH
+#include <immintrin.h>
+#if defined( _MSC_VER ) and not defined( __clang__ )
+#include <intrin.h>
+// MSVC allows all intrinsics without changing the target architecture
+#define DAW_JSON_TARGET_AVX2
+#else
+#define DAW_JSON_TARGET_AVX2 __attribute__( ( target( "avx2" ) ) )
+#endif
+#endif
+
+/// The kernels used by dispatch_exec_tag.  The instruction set is probed once,
+/// the first time a kernel is needed, and the best implementation is stored
+/// in a table of function pointers.  SSE2 is part of x86-64 and is used as the
+/// baseline there.  The SSE2 and AVX2 kernels are the width generic kernels of
+/// daw_not_const_ex_functions.h instantiated with sse2_block_tag and
+/// avx2_block_tag.  The AVX2 ones are compiled with a target attribute so that
+/// no global architecture flags are required.
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details::cpu_dispatch {
+			enum class isa_level : unsigned { scalar, sse2, avx2 };
+
+			constexpr std::string_view to_string( isa_level lvl ) {
+				switch( lvl ) {
+				case isa_level::scalar:
+					return "scalar";
+				case isa_level::sse2:
+					return "sse2";
+				case isa_level::avx2:
+					return "avx2";
+				}
+				return "unknown";
+			}
+
+			inline isa_level detect_isa_level( ) {
+#if defined( DAW_JSON_HAS_CPU_DISPATCH )
+#if defined( _MSC_VER ) and not defined( __clang__ )
+				int regs[4]{ };
+				__cpuid( regs, 0 );
+				if( regs[0] < 7 ) {
+					return isa_level::sse2;
+				}
+				__cpuid( regs, 1 );
+				bool const has_osxsave = ( regs[2] & ( 1 << 27 ) ) != 0;
+				bool const has_avx = ( regs[2] & ( 1 << 28 ) ) != 0;
+				if( not( has_osxsave and has_avx ) ) {
+					return isa_level::sse2;
+				}
+				// The OS must save the ymm registers
+				if( ( _xgetbv( 0 ) & 0x6U ) != 0x6U ) {
+					return isa_level::sse2;
+				}
+				__cpuidex( regs, 7, 0 );
+				if( ( regs[1] & ( 1 << 5 ) ) != 0 ) {
+					return isa_level::avx2;
+				}
+				return isa_level::sse2;
+#else
+				__builtin_cpu_init( );
+				// __builtin_cpu_supports checks that the OS has enabled AVX state
+				if( __builtin_cpu_supports( "avx2" ) ) {
+					return isa_level::avx2;
+				}
+				return isa_level::sse2;
+#endif
+#else
+				return isa_level::scalar;
+#endif
+			}
+
+			/// @brief The instruction set level of the current CPU.  cpuid is only
+			/// queried on the first call
+			inline isa_level current_isa_level( ) {
+				static isa_level const result = detect_isa_level( );
+				return result;
+			}
+
+			DAW_ATTRIB_INLINE std::ptrdiff_t lsb_index( std::uint32_t value ) {
+#if defined( _MSC_VER ) and not defined( __clang__ )
+				unsigned long index;
+				_BitScanForward( &index, value );
+				return static_cast<std::ptrdiff_t>( index );
+#else
+				return static_cast<std::ptrdiff_t>( __builtin_ctz( value ) );
+#endif
+			}
+
+			/// Adapted from
+			/// https://github.com/simdjson/simdjson/blob/master/src/generic/stage1/json_string_scanner.h#L79
+			/// Works on blocks of up to 32 characters.  The carry out of the block
+			/// is stored in prev_escaped and applies to the first character of the
+			/// next block
+			template<unsigned BlockWidth>
+			DAW_ATTRIB_INLINE constexpr std::uint32_t
+			find_escaped( std::uint32_t &prev_escaped, std::uint32_t backslashes ) {
+				static_assert( BlockWidth <= 32 );
+				constexpr std::uint64_t even_bits = 0x5555'5555'5555'5555ULL;
+				constexpr std::uint64_t block_mask = ( 1ULL << BlockWidth ) - 1ULL;
+				std::uint64_t const prev = prev_escaped;
+				std::uint64_t const bs = backslashes & ~prev;
+				std::uint64_t const follow_escape = ( bs << 1U ) | prev;
+				std::uint64_t const odd_seq_start =
+				  bs & ( ~even_bits ) & ( ~follow_escape );
+				std::uint64_t const r = odd_seq_start + bs;
+				prev_escaped = static_cast<std::uint32_t>( r >> BlockWidth );
+				std::uint64_t const invert_mask = ( r & block_mask ) << 1U;
+				return static_cast<std::uint32_t>(
+				  ( even_bits ^ invert_mask ) & follow_escape & block_mask );
+			}
+
+			DAW_ATTRIB_INLINE constexpr bool is_whitespace( char c ) {
+				// Same predicate as the policies trim_left
+				return ( static_cast<unsigned>( static_cast<unsigned char>( c ) ) -
+				         1U ) <= 0x1FU;
+			}
+
+			/***
+			 * The block tags of the dispatched kernels.  They select the 16 and 32
+			 * byte block operations of the width generic kernels
+			 */
+			struct sse2_block_tag : runtime_exec_tag {};
+			struct avx2_block_tag : runtime_exec_tag {};
+
+			/***************************************************************
+			 * Scalar kernels.  Used when no vector unit is known
+			 ***************************************************************/
+			inline char const *skip_string_scalar( char const *first,
+			                                       char const *last,
+			                                       std::ptrdiff_t &first_escape ) {
+				char const *const first_first = first;
+				while( first < last ) {
+					char const c = *first;
+					if( c == '"' ) {
+						return first;
+					}
+					if( c == '\\' ) {
+						if( first_escape < 0 ) {
+							first_escape = first - first_first;
+						}
+						++first;
+					}
+					++first;
+				}
+				return last;
+			}
+
+			inline char const *skip_whitespace_scalar( char const *first,
+			                                           char const *last ) {
+				while( first < last and is_whitespace( *first ) ) {
+					++first;
+				}
+				return first;
+			}
+
+			template<char... keys>
+			inline char const *find_any_of_scalar( char const *first,
+			                                       char const *last ) {
+				while( first < last ) {
+					char const c = *first;
+					if( ( ( c == keys ) | ... ) ) {
+						return first;
+					}
+					++first;
+				}
+				return last;
+			}
+
+			/***************************************************************
+			 * The resolved function tables, see the dispatch_exec_tag section of
+			 * daw_not_const_ex_functions.h
+			 ***************************************************************/
+			using skip_string_fn_t = char const *( * )( char const *, char const *,
+			                                            std::ptrdiff_t & );
+			using skip_whitespace_fn_t = char const *( * )( char const *,
+			                                                char const * );
+			using find_any_of_fn_t = char const *( * )( char const *, char const * );
+
+			struct kernel_table_t {
+				isa_level level;
+				skip_string_fn_t skip_string;
+				skip_whitespace_fn_t skip_whitespace;
+			};
+		} // namespace json_details::cpu_dispatch
+	}   // namespace DAW_JSON_VER
+} // namespace daw::json
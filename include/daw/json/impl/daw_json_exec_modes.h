@@ -12,8 +12,14 @@
 
 #include <daw/daw_scope_guard.h>
 
+#include <cstddef>
 #include <string_view>
 
+#if defined( DAW_ALLOW_AVX2 ) and not defined( DAW_ALLOW_SSE42 )
+// AVX2 kernels fall back to the SSE4.2 ones for the tail of the buffer
+#define DAW_ALLOW_SSE42
+#endif
+
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
 		struct constexpr_exec_tag {
@@ -37,9 +43,40 @@ namespace daw::json {
 			static constexpr bool can_constexpr = false;
 		};
 		using simd_exec_tag = sse42_exec_tag;
+#if defined( DAW_ALLOW_AVX2 )
+		struct avx2_exec_tag : sse42_exec_tag {
+			static constexpr std::string_view name = "avx2";
+			static constexpr bool always_rvo = true;
+			static constexpr bool can_constexpr = false;
+		};
+#else
+		using avx2_exec_tag = simd_exec_tag;
+#endif
 #else
 		struct simd_exec_tag : runtime_exec_tag {};
+		using avx2_exec_tag = simd_exec_tag;
 #endif
+		/// @brief Selects the string skipping, whitespace skipping and character
+		/// search kernels at runtime from the instruction sets the CPU reports.
+		/// Literals and numbers are short and keep their scalar loops.  Does not
+		/// require any architecture flags at compile time
+		struct dispatch_exec_tag : runtime_exec_tag {
+			static constexpr std::string_view name = "dispatch";
+			static constexpr bool always_rvo = true;
+			static constexpr bool can_constexpr = false;
+		};
+		/// @brief The exec tag of the search kernels when the document is followed
+		/// by json_input_padding readable bytes, see options::PaddedInput.  The
+		/// kernels load full blocks up to the end of the document without a
+		/// separate tail
+		template<typename ExecTag>
+		struct padded_exec_tag : ExecTag {};
+
+		/// @brief The number of readable bytes that must follow a document parsed
+		/// with options::PaddedInput.  A block load starting before the end can
+		/// read this far past it
+		inline constexpr std::size_t json_input_padding = 64;
+
 		using default_exec_tag = constexpr_exec_tag;
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
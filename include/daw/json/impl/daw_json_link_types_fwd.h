@@ -15,6 +15,7 @@
 #include "daw_json_parse_class.h"
 #include "daw_json_parse_name.h"
 #include "daw_json_parse_value_fwd.h"
+#include "daw_json_string_intern_fwd.h"
 #include "daw_json_traits.h"
 #include "daw_json_value_fwd.h"
 #include "to_daw_json_string.h"
@@ -27,11 +28,25 @@
 
 #include <chrono>
 #include <ciso646>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string>
+#include <string_view>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
+		/// @brief Tag to construct a json_array_iterator/json_array_range or call
+		/// from_json_array with a slice of an array's elements instead of the whole
+		/// array.  The slice starts at an element, or the whitespace before it, and
+		/// ends one past the ',' or ']' that follows its last element.  See
+		/// json_structural_index in daw_json_parallel.h for finding the element
+		/// boundaries
+		struct json_array_slice_t {
+			explicit json_array_slice_t( ) = default;
+		};
+		inline constexpr json_array_slice_t json_array_slice{ };
+
 		/**
 		 * NOTE:
 		 * Some of the basic json types used for deduction are in
@@ -134,6 +149,42 @@ namespace daw::json {
 		                Options, options::JsonRangeCheck::CheckForNarrowing>,
 		              Constructor>;
 
+		/**
+		 * The member is a decimal number that is parsed to, and serialized from,
+		 * an integer scaled by 10^Scale without using floating point.  e.g.
+		 * 123.4567 is 1234567 with a Scale of 4.  A value with more than Scale
+		 * non-zero decimal places, or that does not fit in T, is an error
+		 * @tparam Name name of json member
+		 * @tparam Scale number of decimal places
+		 * @tparam T signed integer type to pass to Constructor
+		 * @tparam LiteralAsString Could this number be embedded in a string
+		 * @tparam Constructor Callable used to construct result
+		 */
+		template<JSONNAMETYPE Name, std::size_t Scale, typename T = std::int64_t,
+		         json_options_t Options = number_opts_def,
+		         typename Constructor = use_default>
+		struct json_fixed_point;
+
+		/**
+		 * The member is a nullable decimal number that is scaled by 10^Scale, see
+		 * json_fixed_point
+		 * @tparam Name name of json member
+		 * @tparam Scale number of decimal places
+		 * @tparam T result type to pass to Constructor
+		 * @tparam LiteralAsString Could this number be embedded in a string
+		 * @tparam Constructor Callable used to construct result
+		 */
+		template<JSONNAMETYPE Name, std::size_t Scale,
+		         typename T = std::optional<std::int64_t>,
+		         json_options_t Options = number_opts_def,
+		         JsonNullable NullableType = JsonNullable::Nullable,
+		         typename Constructor = use_default>
+		using json_fixed_point_null =
+		  json_nullable<Name, T,
+		                json_base::json_fixed_point<
+		                  Scale, json_details::unwrapped_t<T>, Options>,
+		                NullableType, Constructor>;
+
 		/**
 		 * The member is a boolean
 		 * @tparam Name name of json member
@@ -194,6 +245,81 @@ namespace daw::json {
 		using json_string_null = json_nullable<
 		  Name, T, json_base::json_string<json_details::unwrapped_t<T>, Options>,
 		  NullableType, Constructor>;
+
+		/**
+		 * Member is an escaped string that is a view.  A string without escapes
+		 * is a view of the document.  An escaped string is decoded into memory
+		 * from the allocator passed to from_json_alloc, which must outlive the
+		 * value and is never deallocated by the parser, e.g. an arena.  With
+		 * options::InSituStrings it is decoded in place instead
+		 * @tparam Name of json member
+		 * @tparam String result type constructed by Constructor
+		 * @tparam Constructor a callable taking as arguments ( char const *,
+		 * std::size_t )
+		 * @tparam EightBitMode Allow filtering of characters with the MSB set
+		 */
+		template<JSONNAMETYPE Name, typename String = std::string_view,
+		         json_options_t Options = string_opts_def,
+		         typename Constructor = use_default>
+		struct json_string_arena;
+
+		/**
+		 * Member is a nullable escaped string that is a view, see
+		 * json_string_arena
+		 * @tparam Name of json member
+		 * @tparam T result type constructed by Constructor
+		 * @tparam Constructor a callable taking as arguments ( char const *,
+		 * std::size_t )
+		 * @tparam EightBitMode Allow filtering of characters with the MSB set
+		 */
+		template<JSONNAMETYPE Name,
+		         typename T = std::optional<std::string_view>,
+		         json_options_t Options = string_opts_def,
+		         JsonNullable NullableType = JsonNullable::Nullable,
+		         typename Constructor = use_default>
+		using json_string_arena_null = json_nullable<
+		  Name, T,
+		  json_base::json_string_arena<json_details::unwrapped_t<T>, Options>,
+		  NullableType, Constructor>;
+
+		/**
+		 * Member is an escaped string that is interned in a string intern table,
+		 * so that equal values are stored once.  The table is the one made
+		 * current on the parsing thread with string_intern_scope
+		 * @tparam Name of json member
+		 * @tparam Table string_intern_table, concurrent_string_intern_table, or
+		 * a type with a std::string_view intern( std::string_view ) member
+		 * @tparam String result type constructed by Constructor
+		 * @tparam Constructor a callable taking as arguments ( char const *,
+		 * std::size_t )
+		 * @tparam EightBitMode Allow filtering of characters with the MSB set
+		 */
+		template<JSONNAMETYPE Name, typename Table = string_intern_table,
+		         typename String = std::string_view,
+		         json_options_t Options = string_opts_def,
+		         typename Constructor = use_default>
+		struct json_string_interned;
+
+		/**
+		 * Member is a nullable escaped string that is interned, see
+		 * json_string_interned
+		 * @tparam Name of json member
+		 * @tparam Table The string intern table type
+		 * @tparam T result type constructed by Constructor
+		 * @tparam Constructor a callable taking as arguments ( char const *,
+		 * std::size_t )
+		 * @tparam EightBitMode Allow filtering of characters with the MSB set
+		 */
+		template<JSONNAMETYPE Name, typename Table = string_intern_table,
+		         typename T = std::optional<std::string_view>,
+		         json_options_t Options = string_opts_def,
+		         JsonNullable NullableType = JsonNullable::Nullable,
+		         typename Constructor = use_default>
+		using json_string_interned_null = json_nullable<
+		  Name, T,
+		  json_base::json_string_interned<Table, json_details::unwrapped_t<T>,
+		                                  Options>,
+		  NullableType, Constructor>;
 		/**
 		 * Member is an escaped string and requires unescaping and escaping of
 		 * string data
@@ -11,6 +11,8 @@
 #include "version.h"
 
 #include "daw_json_assert.h"
+#include "daw_json_name_decision_tree.h"
+#include "daw_json_perfect_hash.h"
 #include "daw_murmur3.h"
 
 #include <daw/daw_algorithm.h>
@@ -23,9 +25,12 @@
 #include <daw/daw_uint_buffer.h>
 #include <daw/daw_utility.h>
 
+#include <array>
 #include <ciso646>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <type_traits>
 #include <utility>
 
 #if defined( DAW_JSON_PARSER_DIAGNOSTICS )
@@ -98,12 +103,23 @@ namespace daw::json {
 				}
 			};
 
+			template<typename>
+			inline constexpr bool is_member_name_decision_tree_v = false;
+
+			template<typename... JsonMembers>
+			inline constexpr bool is_member_name_decision_tree_v<
+			  member_name_decision_tree<JsonMembers...>> = true;
+
 			/***
 			 * Contains an array of member location_info mapped in a json_class
 			 * @tparam MemberCount Number of mapped members from json_class
+			 * @tparam MemberLookup How names are found.  void searches the hashes
+			 * linearly, member_name_perfect_hash maps a name hash directly to the
+			 * member index, and member_name_decision_tree matches the name without
+			 * hashing
 			 */
 			template<std::size_t MemberCount, typename CharT,
-			         bool DoFullNameMatch = true>
+			         bool DoFullNameMatch = true, typename MemberLookup = void>
 			struct locations_info_t {
 				using value_type = location_info_t<DoFullNameMatch, CharT>;
 				using reference = value_type &;
@@ -130,25 +146,58 @@ namespace daw::json {
 				[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::size_t
 				find_name( daw::template_vals_t<start_pos>,
 				           daw::string_view key ) const {
-					UInt32 const hash = name_hash<expect_long_strings>( key );
+					if constexpr( is_member_name_decision_tree_v<MemberLookup> ) {
+						// The match is exact, there is no hash to check
+						std::size_t const n = MemberLookup::find( key );
+#if defined( _MSC_VER ) and not defined( __clang__ )
+						(void)start_pos;
+						return n;
+#else
+						// Members before start_pos have been found already, as with the
+						// linear search they are not matched again
+						return n - start_pos < MemberCount - start_pos ? n : MemberCount;
+#endif
+					} else {
+						UInt32 const hash = name_hash<expect_long_strings>( key );
+						if constexpr( not std::is_void_v<MemberLookup> ) {
+							std::size_t const n = MemberLookup::table.find( hash );
+#if defined( _MSC_VER ) and not defined( __clang__ )
+							(void)start_pos;
+							bool const is_candidate = n < MemberCount;
+#else
+							bool const is_candidate =
+							  n - start_pos < MemberCount - start_pos;
+#endif
+							if( is_candidate and hashes[n] == hash ) {
+								if constexpr( do_full_name_match ) {
+									if( DAW_UNLIKELY( key != names[n].name ) ) {
+										return MemberCount;
+									}
+								}
+								return n;
+							}
+							return MemberCount;
+						} else {
 #if defined( _MSC_VER ) and not defined( __clang__ )
-					// MSVC has a bug where the list initialization isn't sequenced in
-					// order of appearance.
-					(void)start_pos;
-					for( std::size_t n = 0; n < MemberCount; ++n ) {
+							// MSVC has a bug where the list initialization isn't sequenced
+							// in order of appearance.
+							(void)start_pos;
+							for( std::size_t n = 0; n < MemberCount; ++n ) {
 #else
-					for( std::size_t n = start_pos; n < MemberCount; ++n ) {
+							for( std::size_t n = start_pos; n < MemberCount; ++n ) {
 #endif
-						if( hashes[n] == hash ) {
-							if constexpr( do_full_name_match ) {
-								if( DAW_UNLIKELY( key != names[n].name ) ) {
-									continue;
+								if( hashes[n] == hash ) {
+									if constexpr( do_full_name_match ) {
+										if( DAW_UNLIKELY( key != names[n].name ) ) {
+											continue;
+										}
+									}
+									return n;
 								}
 							}
-							return n;
+							return MemberCount;
 						}
 					}
-					return MemberCount;
 				}
 			};
 
@@ -165,6 +214,52 @@ namespace daw::json {
 					                                      return l == r;
 				                                      } ) != daw::data_end( hashes );
 			}
+			/// @brief The compile time perfect hash of the member names of a class
+			template<typename... JsonMembers>
+			struct member_name_perfect_hash {
+				static constexpr auto table = make_perfect_hash<sizeof...( JsonMembers )>(
+				  std::array<std::uint32_t, sizeof...( JsonMembers )>{
+				    static_cast<std::uint32_t>(
+				      name_hash<false>( JsonMembers::name ) )... } );
+			};
+
+			/// @brief Use a perfect hash for classes with many members when the
+			/// member name hashes are distinct.  Otherwise find_name searches linearly
+			template<typename... JsonMembers>
+			inline DAW_CONSTEVAL bool use_member_perfect_hash( ) {
+				if constexpr( sizeof...( JsonMembers ) < perfect_hash_min_members ) {
+					return false;
+				} else {
+					return member_name_perfect_hash<JsonMembers...>::table.is_valid;
+				}
+			}
+
+			template<bool UsePerfectHash, typename... JsonMembers>
+			struct select_member_perfect_hash {
+				using type = void;
+			};
+
+			template<typename... JsonMembers>
+			struct select_member_perfect_hash<true, JsonMembers...> {
+				using type = member_name_perfect_hash<JsonMembers...>;
+			};
+
+			/// @brief Use the decision tree of options::MemberNameLookup when the
+			/// member names are distinct.  Otherwise find_name searches linearly
+			/// from start_pos, so that a JSON name mapped twice finds both members
+			template<bool UseDecisionTree, typename... JsonMembers>
+			struct select_member_decision_tree {
+				using type = typename select_member_perfect_hash<
+				  use_member_perfect_hash<JsonMembers...>( ), JsonMembers...>::type;
+			};
+
+			template<typename... JsonMembers>
+			struct select_member_decision_tree<true, JsonMembers...> {
+				using type = std::conditional_t<
+				  member_name_decision_tree<JsonMembers...>::has_distinct_names,
+				  member_name_decision_tree<JsonMembers...>, void>;
+			};
+
 #if defined( _MSC_VER ) and not defined( __clang__ )
 #define DAW_JSON_MAKE_LOC_INFO_CONSTEVAL constexpr
 #else
@@ -188,15 +283,17 @@ namespace daw::json {
 				constexpr bool do_full_name_match =
 				  ParseState::force_name_equal_check( ) or
 				  do_hashes_collide<JsonMembers...>( );
+				using member_lookup_t = typename select_member_decision_tree<
+				  ParseState::use_length_prefix_names( ), JsonMembers...>::type;
 				if constexpr( do_full_name_match ) {
 					return locations_info_t<sizeof...( JsonMembers ), CharT,
-					                        do_full_name_match>{
+					                        do_full_name_match, member_lookup_t>{
 					  { daw::name_hash<false>( JsonMembers::name )... },
 					  { location_info_t<do_full_name_match, CharT>{
 					    JsonMembers::name }... } };
 				} else {
 					return locations_info_t<sizeof...( JsonMembers ), CharT,
-					                        do_full_name_match>{
+					                        do_full_name_match, member_lookup_t>{
 					  { daw::name_hash<false>( JsonMembers::name )... }, {} };
 				}
 #endif
@@ -214,10 +311,10 @@ namespace daw::json {
 			enum class AllMembersMustExist { yes, no };
 			template<std::size_t pos, AllMembersMustExist must_exist,
 			         bool from_start = false, std::size_t N, typename ParseState,
-			         bool B, typename CharT>
+			         bool B, typename CharT, typename MemberLookup>
 			[[nodiscard]] inline constexpr std::pair<ParseState, bool>
 			find_class_member( ParseState &parse_state,
-			                   locations_info_t<N, CharT, B> &locations,
+			                   locations_info_t<N, CharT, B, MemberLookup> &locations,
 			                   bool is_nullable, daw::string_view member_name ) {
 
 				// silencing gcc9 warning as these are selectively used
@@ -297,8 +394,9 @@ namespace daw::json {
 					    .with_allocator( parse_state ),
 					  known };
 				} else {
-					return std::pair<ParseState, bool>{
-					  locations[pos].get_range( template_arg<ParseState> ), known };
+					auto result = locations[pos].get_range( template_arg<ParseState> );
+					result.set_structural_index( parse_state.get_structural_index( ) );
+					return std::pair<ParseState, bool>{ result, known };
 				}
 			}
 		} // namespace json_details
@@ -0,0 +1,60 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include <array>
+#include <ciso646>
+#include <cstddef>
+#include <cstdint>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/***
+			 * The order the members of T were in the last document parsed on this
+			 * thread, as indices into the member list.  It starts as the order of
+			 * the mapping.  See options::LearnMemberOrder
+			 */
+			template<typename T, std::size_t MemberCount>
+			struct learned_member_order {
+				static_assert( MemberCount < 0xFFFFU, "Too many members to learn" );
+				using order_t = std::array<std::uint16_t, MemberCount>;
+
+				[[nodiscard]] static order_t &get( ) {
+					static thread_local order_t order = [] {
+						auto result = order_t{ };
+						for( std::size_t n = 0; n < MemberCount; ++n ) {
+							result[n] = static_cast<std::uint16_t>( n );
+						}
+						return result;
+					}( );
+					return order;
+				}
+
+				/// @brief Store the order that was seen.  Members that were not in
+				/// the document follow in mapping order
+				static void publish( order_t const &seen, std::size_t seen_count ) {
+					auto &order = get( );
+					auto is_seen = std::array<bool, MemberCount>{ };
+					for( std::size_t n = 0; n < seen_count; ++n ) {
+						order[n] = seen[n];
+						is_seen[seen[n]] = true;
+					}
+					for( std::size_t n = 0; n < MemberCount; ++n ) {
+						if( not is_seen[n] ) {
+							order[seen_count++] = static_cast<std::uint16_t>( n );
+						}
+					}
+				}
+			};
+		} // namespace json_details
+	}   // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,171 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_string_view.h>
+
+#include <array>
+#include <ciso646>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief Load Size(at most 8) bytes as a little endian word.  The size
+			/// is known at compile time, so this is a load or two
+			template<std::size_t Size, typename CharT>
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::uint64_t
+			load_name_word( CharT const *ptr ) {
+				static_assert( Size <= 8 );
+				std::uint64_t result = 0;
+				for( std::size_t n = 0; n < Size; ++n ) {
+					result |= static_cast<std::uint64_t>(
+					            static_cast<unsigned char>( ptr[n] ) )
+					          << ( 8U * n );
+				}
+				return result;
+			}
+
+			[[nodiscard]] constexpr std::uint64_t
+			load_name_word( daw::string_view name, std::size_t offset ) {
+				std::uint64_t result = 0;
+				for( std::size_t n = 0; n < 8 and offset + n < name.size( ); ++n ) {
+					result |= static_cast<std::uint64_t>(
+					            static_cast<unsigned char>( name[offset + n] ) )
+					          << ( 8U * n );
+				}
+				return result;
+			}
+
+			/***
+			 * Find a member without hashing the name.  The lookup switches on the
+			 * name's length, and for the members of that length compares the first
+			 * two 8 byte words of the name.  Names longer than 16 bytes compare the
+			 * rest too.  A match is exact, so no hash or name check is needed
+			 * after.  See options::MemberNameLookup
+			 */
+			template<typename... JsonMembers>
+			struct member_name_decision_tree {
+				static constexpr std::size_t member_count = sizeof...( JsonMembers );
+
+				struct name_entry {
+					std::size_t size;
+					std::uint64_t word0;
+					std::uint64_t word1;
+				};
+
+				static constexpr std::array<name_entry, member_count> names = {
+				  name_entry{ daw::string_view( JsonMembers::name ).size( ),
+				              load_name_word( JsonMembers::name, 0 ),
+				              load_name_word( JsonMembers::name, 8 ) }... };
+
+				static constexpr std::array<daw::string_view, member_count> full_names =
+				  { daw::string_view( JsonMembers::name )... };
+
+				/// The tree finds the first member with a name.  When a JSON name is
+				/// mapped more than once the later members are never found, so the
+				/// tree is only used for distinct names
+				static constexpr bool has_distinct_names = [] {
+					for( std::size_t n = 0; n < member_count; ++n ) {
+						for( std::size_t m = n + 1U; m < member_count; ++m ) {
+							if( full_names[n] == full_names[m] ) {
+								return false;
+							}
+						}
+					}
+					return true;
+				}( );
+
+				// The distinct name lengths, these are the branches of the tree
+				static constexpr auto sizes = [] {
+					std::array<std::size_t, member_count> result{ };
+					std::size_t count = 0;
+					for( auto const &e : names ) {
+						bool is_new = true;
+						for( std::size_t n = 0; n < count; ++n ) {
+							is_new = is_new and result[n] != e.size;
+						}
+						if( is_new ) {
+							result[count++] = e.size;
+						}
+					}
+					return std::pair{ result, count };
+				}( );
+
+				template<std::size_t Size, std::size_t Idx>
+				[[nodiscard]] DAW_ATTRIB_INLINE static constexpr bool
+				is_member( std::uint64_t word0, std::uint64_t word1,
+				           daw::string_view key ) {
+					if constexpr( names[Idx].size != Size ) {
+						return false;
+					} else {
+						if( word0 != names[Idx].word0 ) {
+							return false;
+						}
+						if constexpr( Size > 8 ) {
+							if( word1 != names[Idx].word1 ) {
+								return false;
+							}
+						}
+						if constexpr( Size > 16 ) {
+							return key.substr( 16 ) == full_names[Idx].substr( 16 );
+						} else {
+							(void)word1;
+							(void)key;
+							return true;
+						}
+					}
+				}
+
+				template<std::size_t Size, std::size_t... Is>
+				[[nodiscard]] DAW_ATTRIB_INLINE static constexpr std::size_t
+				find_sized( daw::string_view key, std::index_sequence<Is...> ) {
+					auto const *ptr = std::data( key );
+					std::uint64_t const word0 =
+					  load_name_word<( Size < 8 ? Size : 8 )>( ptr );
+					std::uint64_t word1 = 0;
+					if constexpr( Size > 8 ) {
+						word1 = load_name_word<( Size < 16 ? Size - 8 : 8 )>( ptr + 8 );
+					}
+					std::size_t result = member_count;
+					(void)( ( is_member<Size, Is>( word0, word1, key )
+					            ? ( result = Is, true )
+					            : false ) or
+					        ... );
+					return result;
+				}
+
+				template<std::size_t... Ss>
+				[[nodiscard]] DAW_ATTRIB_INLINE static constexpr std::size_t
+				find_impl( daw::string_view key, std::index_sequence<Ss...> ) {
+					std::size_t const size = key.size( );
+					std::size_t result = member_count;
+					(void)( ( size == sizes.first[Ss]
+					            ? ( result = find_sized<sizes.first[Ss]>(
+					                  key, std::make_index_sequence<member_count>{ } ),
+					                true )
+					            : false ) or
+					        ... );
+					return result;
+				}
+
+				/// @return The index of the member named key, or member_count
+				[[nodiscard]] DAW_ATTRIB_INLINE static constexpr std::size_t
+				find( daw::string_view key ) {
+					return find_impl( key, std::make_index_sequence<sizes.second>{ } );
+				}
+			};
+		} // namespace json_details
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -13,8 +13,10 @@
 #include "../daw_json_exception.h"
 #include "daw_json_assert.h"
 #include "daw_json_location_info.h"
+#include "daw_json_member_order.h"
 #include "daw_json_name.h"
 #include "daw_json_parse_common.h"
+#include "daw_json_parse_name.h"
 #include "daw_json_parse_value.h"
 #include "daw_json_skip.h"
 
@@ -24,9 +26,13 @@
 #include <daw/daw_likely.h>
 #include <daw/daw_traits.h>
 
+#include <array>
 #include <ciso646>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
+#include <optional>
+#include <tuple>
 #include <type_traits>
 
 namespace daw::json {
@@ -84,10 +90,88 @@ namespace daw::json {
 				  parse_state, ParseTag<json_member_t::expected_type>{ } );
 			}
 
+			/// @brief Member names without quotes or escapes are the same in the
+			/// document, so they can be compared byte for byte
+			template<typename JsonMember>
+			inline constexpr bool is_plain_member_name_v = [] {
+				for( char const c : daw::string_view( JsonMember::name ) ) {
+					if( c == '"' or c == '\\' ) {
+						return false;
+					}
+				}
+				return true;
+			}( );
+
+			///
+			/// @brief Check if the next member in the document is JsonMember by
+			/// comparing it to "name" directly.  When it is, the name and the colon
+			/// are consumed.  With unchecked input, names that cannot be missing are
+			/// skipped without comparing them.
+			/// @pre parse_state.is_at_next_class_member( )
+			/// @return true if the value of JsonMember is next
+			///
+			template<typename JsonMember, typename ParseState>
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr bool
+			match_ordered_member_name( ParseState &parse_state ) {
+				if constexpr( not is_plain_member_name_v<JsonMember> or
+				              ParseState::allow_escaped_names( ) ) {
+					(void)parse_state;
+					return false;
+				} else {
+					constexpr auto member_name = daw::string_view( JsonMember::name );
+					if constexpr( not ParseState::is_unchecked_input or
+					              is_json_nullable_v<JsonMember> ) {
+						if( parse_state.size( ) < member_name.size( ) + 2U or
+						    parse_state.front( ) != '"' or
+						    parse_state.first[member_name.size( ) + 1U] != '"' or
+						    daw::string_view( parse_state.first + 1,
+						                      member_name.size( ) ) != member_name ) {
+							return false;
+						}
+					}
+					parse_state.remove_prefix( member_name.size( ) + 2U );
+					name::name_parser::trim_end_of_name( parse_state );
+					return true;
+				}
+			}
+
+			///
+			/// @brief Parse the value of a member at the current position
+			///
+			template<typename JsonMember, bool NeedsClassPositions,
+			         typename ParseState>
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr json_result<JsonMember>
+			parse_class_member_here( ParseState &parse_state ) {
+				if constexpr( NeedsClassPositions ) {
+					auto const cf = parse_state.class_first;
+					auto const cl = parse_state.class_last;
+					if constexpr( use_direct_construction_v<ParseState,
+					                                        without_name<JsonMember>> ) {
+						auto const after_parse = daw::on_scope_exit( [&] {
+							parse_state.class_first = cf;
+							parse_state.class_last = cl;
+						} );
+						return parse_value<without_name<JsonMember>>(
+						  parse_state, ParseTag<JsonMember::expected_type>{ } );
+					} else {
+						auto result = parse_value<without_name<JsonMember>>(
+						  parse_state, ParseTag<JsonMember::expected_type>{ } );
+						parse_state.class_first = cf;
+						parse_state.class_last = cl;
+						return result;
+					}
+				} else {
+					return parse_value<without_name<JsonMember>>(
+					  parse_state, ParseTag<JsonMember::expected_type>{ } );
+				}
+			}
+
 			///
 			///@brief Parse a member from a json_class
 			///@tparam member_position position in json_class member list
 			///@tparam JsonMember type description of member to parse
+			///@tparam ExpectOrdered try the next member in the document first, see
+			/// options::ExpectOrderedMembers
 			///@tparam N Number of members in json_class
 			///@tparam ParseState see IteratorRange
 			///@param locations location info for members
@@ -96,44 +180,35 @@ namespace daw::json {
 			///
 			template<std::size_t member_position, typename JsonMember,
 			         AllMembersMustExist must_exist, bool NeedsClassPositions,
-			         typename ParseState, std::size_t N, typename CharT, bool B>
+			         bool ExpectOrdered, typename ParseState, std::size_t N,
+			         typename CharT, bool B, typename MemberLookup>
 			[[nodiscard]] DAW_ATTRIB_INLINE constexpr json_result<JsonMember>
-			parse_class_member( ParseState &parse_state,
-			                    locations_info_t<N, CharT, B> &locations ) {
+			parse_class_member(
+			  ParseState &parse_state,
+			  locations_info_t<N, CharT, B, MemberLookup> &locations ) {
 				parse_state.move_next_member_or_end( );
 
 				daw_json_assert_weak( parse_state.is_at_next_class_member( ),
 				                      ErrorReason::MissingMemberNameOrEndOfClass,
 				                      parse_state );
 
+				if constexpr( ExpectOrdered ) {
+					if( DAW_LIKELY( locations[member_position].missing( ) and
+					                match_ordered_member_name<JsonMember>(
+					                  parse_state ) ) ) {
+						return parse_class_member_here<JsonMember, NeedsClassPositions>(
+						  parse_state );
+					}
+				}
+
 				auto [loc, known] = find_class_member<member_position, must_exist>(
 				  parse_state, locations, is_json_nullable_v<JsonMember>,
 				  JsonMember::name );
 
 				// If the member was found loc will have it's position
 				if( not known ) {
-					if constexpr( NeedsClassPositions ) {
-						auto const cf = parse_state.class_first;
-						auto const cl = parse_state.class_last;
-						if constexpr( use_direct_construction_v<
-						                ParseState, without_name<JsonMember>> ) {
-							auto const after_parse = daw::on_scope_exit( [&] {
-								parse_state.class_first = cf;
-								parse_state.class_last = cl;
-							} );
-							return parse_value<without_name<JsonMember>>(
-							  parse_state, ParseTag<JsonMember::expected_type>{ } );
-						} else {
-							auto result = parse_value<without_name<JsonMember>>(
-							  parse_state, ParseTag<JsonMember::expected_type>{ } );
-							parse_state.class_first = cf;
-							parse_state.class_last = cl;
-							return result;
-						}
-					} else {
-						return parse_value<without_name<JsonMember>>(
-						  parse_state, ParseTag<JsonMember::expected_type>{ } );
-					}
+					return parse_class_member_here<JsonMember, NeedsClassPositions>(
+					  parse_state );
 				}
 				// We cannot find the member, check if the member is nullable
 				if( loc.is_null( ) ) {
@@ -204,6 +279,109 @@ namespace daw::json {
 				}
 			};
 
+			///
+			/// @brief Parse the members of a class in the order they are in the
+			/// document, then construct it.  The name at each position is compared
+			/// with the member that was there in the last document first, see
+			/// options::LearnMemberOrder.
+			/// @pre parse_state is after the opening brace of the class
+			///
+			template<typename JsonClass, bool NeedsClassPositions,
+			         typename... JsonMembers, typename ParseState,
+			         typename OldClassPos, std::size_t... Is>
+			[[nodiscard]] json_result<JsonClass>
+			parse_json_class_in_learned_order( ParseState &parse_state,
+			                                   OldClassPos const &old_class_pos,
+			                                   std::index_sequence<Is...> ) {
+				using T = typename JsonClass::parse_to_t;
+				using Constructor = typename JsonClass::constructor_t;
+				constexpr std::size_t member_count = sizeof...( JsonMembers );
+				using learned_order_t = learned_member_order<T, member_count>;
+				constexpr auto names = std::array<daw::string_view, member_count>{
+				  daw::string_view( JsonMembers::name )... };
+#if not defined( _MSC_VER ) or defined( __clang__ )
+				auto const known_locations = DAW_AS_CONSTANT(
+				  ( make_locations_info<ParseState, JsonMembers...>( ) ) );
+#else
+				auto const known_locations =
+				  make_locations_info<ParseState, JsonMembers...>( );
+#endif
+				auto const &order = learned_order_t::get( );
+				auto seen = typename learned_order_t::order_t{ };
+				std::size_t seen_count = 0;
+				bool is_mispredicted = false;
+				auto values = std::tuple<std::optional<json_result<JsonMembers>>...>{ };
+
+				parse_state.move_to_next_class_member( );
+				while( parse_state.front_checked( ) != '}' ) {
+					auto const name = parse_name( parse_state );
+					std::size_t idx = member_count;
+					if( seen_count < member_count and
+					    names[order[seen_count]] == name ) {
+						idx = order[seen_count];
+					} else {
+						is_mispredicted = true;
+						idx = known_locations
+						        .template find_name<ParseState::expect_long_strings>(
+						          template_vals<0>, name );
+					}
+					if( idx < member_count and
+					    not( ( idx == Is and std::get<Is>( values ).has_value( ) ) or
+					         ... ) ) {
+						(void)( ( idx == Is and
+						          ( std::get<Is>( values ).emplace(
+						              parse_class_member_here<JsonMembers,
+						                                      NeedsClassPositions>(
+						                parse_state ) ),
+						            true ) ) or
+						        ... );
+						seen[seen_count++] = static_cast<std::uint16_t>( idx );
+					} else {
+						if constexpr( all_json_members_must_exist_v<T, ParseState> ) {
+							daw_json_error( ErrorReason::UnknownMember, parse_state );
+						}
+						(void)skip_value( parse_state );
+					}
+					parse_state.move_next_member_or_end( );
+				}
+				if( is_mispredicted or seen_count < member_count ) {
+					learned_order_t::publish( seen, seen_count );
+				}
+
+				// Members that were not in the document must be nullable
+				auto const fill_missing = [&]( auto &value, auto member ) {
+					using json_member_t = typename decltype( member )::type;
+					if( not value ) {
+						if constexpr( is_json_nullable_v<json_member_t> ) {
+							auto loc = ParseState{ };
+							value.emplace( parse_value<without_name<json_member_t>, true>(
+							  loc, ParseTag<json_member_t::expected_type>{ } ) );
+						} else {
+							daw_json_error( missing_member( std::string_view(
+							                  std::data( json_member_t::name ),
+							                  std::size( json_member_t::name ) ) ),
+							                parse_state );
+						}
+					}
+				};
+				( fill_missing( std::get<Is>( values ),
+				                daw::traits::identity<JsonMembers>{ } ),
+				  ... );
+
+				auto result = [&] {
+					if constexpr( force_aggregate_construction_v<T> ) {
+						return T{ json_result<JsonMembers>(
+						  DAW_MOVE( *std::get<Is>( values ) ) )... };
+					} else {
+						return construct_value_tp<T, Constructor>(
+						  parse_state, fwd_pack{ json_result<JsonMembers>(
+						                 DAW_MOVE( *std::get<Is>( values ) ) )... } );
+					}
+				}( );
+				class_cleanup_now<true>( parse_state, old_class_pos );
+				return result;
+			}
+
 			///
 			/// @brief Parse to the user supplied class.  The parser will run
 			/// left->right if it can when the JSON document's order matches that of
@@ -253,6 +431,20 @@ namespace daw::json {
 				} else {
 					using NeedClassPositions = std::bool_constant<(
 					  ( JsonMembers::must_be_class_member or ... ) )>;
+					using ExpectOrdered =
+					  std::bool_constant<expect_ordered_members_v<T, ParseState>>;
+
+#if defined( DAW_IS_CONSTANT_EVALUATED )
+					if constexpr( learn_member_order_v<T, ParseState> and
+					              not use_direct_construction_v<ParseState,
+					                                            JsonClass> ) {
+						if( not DAW_IS_CONSTANT_EVALUATED( ) ) {
+							return parse_json_class_in_learned_order<
+							  JsonClass, NeedClassPositions::value, JsonMembers...>(
+							  parse_state, old_class_pos, std::index_sequence<Is...>{ } );
+						}
+					}
+#endif
 
 #if not defined( _MSC_VER ) or defined( __clang__ )
 					auto known_locations = DAW_AS_CONSTANT(
@@ -276,19 +468,22 @@ namespace daw::json {
 						if constexpr( force_aggregate_construction_v<T> ) {
 							return T{ parse_class_member<
 							  Is, traits::nth_type<Is, JsonMembers...>, must_exist::value,
-							  NeedClassPositions::value>( parse_state, known_locations )... };
+							  NeedClassPositions::value, ExpectOrdered::value>(
+							  parse_state, known_locations )... };
 						} else {
 							return construct_value_tp<T, Constructor>(
 							  parse_state, fwd_pack{ parse_class_member<
 							                 Is, traits::nth_type<Is, JsonMembers...>,
-							                 must_exist::value, NeedClassPositions::value>(
-							                 parse_state, known_locations )... } );
+							                 must_exist::value, NeedClassPositions::value,
+							                 ExpectOrdered::value>( parse_state,
+							                                        known_locations )... } );
 						}
 					} else {
 						if constexpr( force_aggregate_construction_v<T> ) {
 							auto result = T{ parse_class_member<
 							  Is, traits::nth_type<Is, JsonMembers...>, must_exist::value,
-							  NeedClassPositions::value>( parse_state, known_locations )... };
+							  NeedClassPositions::value, ExpectOrdered::value>(
+							  parse_state, known_locations )... };
 
 							class_cleanup_now<
 							  json_details::all_json_members_must_exist_v<T, ParseState>>(
@@ -298,8 +493,9 @@ namespace daw::json {
 							auto result = construct_value_tp<T, Constructor>(
 							  parse_state, fwd_pack{ parse_class_member<
 							                 Is, traits::nth_type<Is, JsonMembers...>,
-							                 must_exist::value, NeedClassPositions::value>(
-							                 parse_state, known_locations )... } );
+							                 must_exist::value, NeedClassPositions::value,
+							                 ExpectOrdered::value>( parse_state,
+							                                        known_locations )... } );
 
 							class_cleanup_now<
 							  json_details::all_json_members_must_exist_v<T, ParseState>>(
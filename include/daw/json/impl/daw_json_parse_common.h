@@ -34,6 +34,7 @@
 #include <array>
 #include <ciso646>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <optional>
 #include <string>
@@ -173,6 +174,18 @@ namespace daw::json {
 			inline constexpr bool is_submember_tagged_variant_v =
 			  daw::is_detected_v<is_submember_tagged_variant_t, T>;
 
+			template<typename T>
+			using json_member_fixed_point_scale_t =
+			  decltype( T::fixed_point_scale );
+
+			/***
+			 * The member is a json_fixed_point, a Signed number that is scaled by
+			 * 10^fixed_point_scale
+			 */
+			template<typename T>
+			inline constexpr bool is_fixed_point_v =
+			  daw::is_detected_v<json_member_fixed_point_scale_t, T>;
+
 			template<typename T>
 			using json_nullable_member_type_t = typename T::member_type;
 
@@ -282,6 +295,15 @@ namespace daw::json {
 			  json_nullable<T, json_string<json_details::unwrapped_t<T>, Options>,
 			                NullableType, Constructor>;
 
+			template<typename T, json_options_t Options = string_opts_def,
+			         typename Constructor = use_default>
+			struct json_string_arena;
+
+			template<typename Table, typename T,
+			         json_options_t Options = string_opts_def,
+			         typename Constructor = use_default>
+			struct json_string_interned;
+
 			template<typename T, json_options_t Options = bool_opts_def,
 			         typename Constructor = use_default>
 			struct json_bool;
@@ -307,6 +329,11 @@ namespace daw::json {
 			  json_nullable<T, json_number<json_details::unwrapped_t<T>, Options>,
 			                NullableType, Constructor>;
 
+			template<std::size_t Scale, typename T = std::int64_t,
+			         json_options_t Options = number_opts_def,
+			         typename Constructor = use_default>
+			struct json_fixed_point;
+
 			template<typename Container, typename JsonValueType = use_default,
 			         typename JsonKeyType = use_default,
 			         typename Constructor = use_default>
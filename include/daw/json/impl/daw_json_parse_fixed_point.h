@@ -0,0 +1,88 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "daw_json_parse_digit.h"
+#include "daw_json_parse_unsigned_int.h"
+
+#include <daw/daw_attributes.h>
+
+#include <ciso646>
+#include <cstddef>
+#include <cstdint>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			inline constexpr std::uint64_t fixed_point_pow10[] = {
+			  1ULL,
+			  10ULL,
+			  100ULL,
+			  1'000ULL,
+			  10'000ULL,
+			  100'000ULL,
+			  1'000'000ULL,
+			  10'000'000ULL,
+			  100'000'000ULL,
+			  1'000'000'000ULL,
+			  10'000'000'000ULL,
+			  100'000'000'000ULL,
+			  1'000'000'000'000ULL,
+			  10'000'000'000'000ULL,
+			  100'000'000'000'000ULL,
+			  1'000'000'000'000'000ULL,
+			  10'000'000'000'000'000ULL,
+			  100'000'000'000'000'000ULL,
+			  1'000'000'000'000'000'000ULL,
+			  10'000'000'000'000'000'000ULL };
+
+			/// The largest number of significant digits that always fit in a
+			/// std::uint64_t
+			inline constexpr std::ptrdiff_t fixed_point_max_digits = 19;
+
+			template<typename CharT>
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr CharT *
+			skip_fixed_point_digits( CharT *first, CharT *const last ) {
+				while( last - first >= 8 and is_made_of_eight_digits_cx( first ) ) {
+					first += 8;
+				}
+				while( first < last and parse_digit( *first ) < 10U ) {
+					++first;
+				}
+				return first;
+			}
+
+			/***
+			 * Append the digits in [first, last) to value.  The caller ensures
+			 * that the result has at most fixed_point_max_digits digits
+			 */
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::uint64_t
+			accumulate_fixed_point_digits( std::uint64_t value, char const *first,
+			                               char const *const last ) {
+				if( last - first >= 16 ) {
+					value *= 10'000'000'000'000'000ULL;
+					value += static_cast<std::uint64_t>( parse_16_digits( first ) );
+					first += 16;
+				} else if( last - first >= 8 ) {
+					value *= 100'000'000ULL;
+					value += static_cast<std::uint64_t>( parse_8_digits( first ) );
+					first += 8;
+				}
+				while( first < last ) {
+					value *= 10U;
+					value += parse_digit( *first );
+					++first;
+				}
+				return value;
+			}
+		} // namespace json_details
+	}   // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -41,6 +41,9 @@ namespace daw::json {
 				parse_nq( ParseState &parse_state ) {
 					if constexpr( ParseState::allow_escaped_names( ) ) {
 						auto r = skip_string_nq( parse_state );
+						if constexpr( ParseState::is_validate_utf8_names ) {
+							ensure_valid_utf8( r, std::data( r ), daw::data_end( r ) );
+						}
 						trim_end_of_name( parse_state );
 						return daw::string_view( std::data( r ), std::size( r ) );
 					} else {
@@ -54,6 +57,9 @@ namespace daw::json {
 						                        *std::prev( parse_state.first ) != '\\',
 						                      ErrorReason::InvalidString, parse_state );
 						auto result = daw::string_view( ptr, parse_state.first );
+						if constexpr( ParseState::is_validate_utf8_names ) {
+							ensure_valid_utf8( parse_state, ptr, parse_state.first );
+						}
 						parse_state.remove_prefix( );
 						trim_end_of_name( parse_state );
 						return result;
@@ -0,0 +1,122 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "daw_json_assert.h"
+#include "daw_json_parse_common.h"
+#include "daw_json_parse_value_fwd.h"
+#include "daw_not_const_ex_functions.h"
+
+#include <ciso646>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			template<typename JsonElement, typename = void>
+			inline constexpr bool is_bulk_number_element_v = false;
+
+			template<typename JsonElement>
+			inline constexpr bool is_bulk_number_element_v<
+			  JsonElement,
+			  std::enable_if_t<( JsonElement::expected_type == JsonParseTypes::Real or
+			                     JsonElement::expected_type ==
+			                       JsonParseTypes::Signed or
+			                     JsonElement::expected_type ==
+			                       JsonParseTypes::Unsigned )>> =
+			  JsonElement::literal_as_string == options::LiteralAsStringOpt::Never and
+			  std::is_arithmetic_v<json_result<JsonElement>> and
+			  std::is_same_v<typename JsonElement::constructor_t,
+			                 default_constructor<json_result<JsonElement>>>;
+
+			template<typename JsonMember, typename = void>
+			inline constexpr bool is_number_array_v = false;
+
+			/***
+			 * A json_array of numbers that is parsed into a std::vector with the
+			 * default constructors.  These are parsed into a vector of the counted
+			 * size instead of through json_parse_array_iterator
+			 */
+			template<typename JsonMember>
+			inline constexpr bool is_number_array_v<
+			  JsonMember, std::void_t<typename JsonMember::json_element_t>> =
+			  is_bulk_number_element_v<typename JsonMember::json_element_t> and
+			  std::is_same_v<
+			    json_result<JsonMember>,
+			    std::vector<json_result<typename JsonMember::json_element_t>>> and
+			  std::is_same_v<typename JsonMember::constructor_t,
+			                 default_constructor<json_result<JsonMember>>>;
+
+			/***
+			 * @return The number of elements of the array of numbers starting at
+			 * parse_state.first, or -1 when it has other values and must be parsed
+			 * element by element
+			 */
+			template<typename ParseState>
+			DAW_ATTRIB_INLINE constexpr std::ptrdiff_t
+			number_array_size( ParseState const &parse_state ) {
+				if( parse_state.first < parse_state.last and
+				    parse_state.front( ) == ']' ) {
+					return 0;
+				}
+#if defined( DAW_ALLOW_SSE42 )
+				if constexpr( ParseState::is_simd_exec_mode ) {
+					return mem_count_number_array_elements(
+					  ParseState::exec_tag, parse_state.first, parse_state.last );
+				} else
+#endif
+				{
+					return count_number_array_elements(
+					  constexpr_exec_tag{ }, parse_state.first, parse_state.last );
+				}
+			}
+
+			/***
+			 * Parse an array of count numbers directly into the storage of the
+			 * result.  parse_state.first is after the opening bracket and any
+			 * whitespace
+			 */
+			template<typename JsonMember, bool KnownBounds, typename ParseState>
+			[[nodiscard]] constexpr json_result<JsonMember>
+			parse_number_array( ParseState &parse_state, std::size_t count ) {
+				using element_t = typename JsonMember::json_element_t;
+				auto result = json_result<JsonMember>( );
+				result.resize( count );
+				auto *out = result.data( );
+				auto *const out_last = out + count;
+				while( out != out_last ) {
+					*out = parse_value<element_t>(
+					  parse_state, ParseTag<element_t::expected_type>{ } );
+					parse_state.trim_left( );
+					if( ++out != out_last ) {
+						daw_json_assert_weak( parse_state.has_more( ) and
+						                        parse_state.front( ) == ',',
+						                      ErrorReason::UnexpectedEndOfData,
+						                      parse_state );
+						parse_state.remove_prefix( );
+						parse_state.trim_left( );
+					}
+				}
+				daw_json_assert_weak( parse_state.has_more( ) and
+				                        parse_state.front( ) == ']',
+				                      ErrorReason::UnexpectedEndOfData, parse_state );
+				if constexpr( not KnownBounds ) {
+					// Cleanup at end of value
+					parse_state.remove_prefix( );
+					parse_state.trim_left_checked( );
+				}
+				return result;
+			}
+		} // namespace json_details
+	}   // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -36,6 +36,10 @@ namespace daw::json {
 					return "runtime";
 				case ExecModeTypes::simd:
 					return "simd";
+				case ExecModeTypes::avx2:
+					return "avx2";
+				case ExecModeTypes::dispatch:
+					return "dispatch";
 				}
 				DAW_UNREACHABLE( );
 			}
@@ -44,7 +48,7 @@ namespace daw::json {
 		namespace json_details {
 			template<>
 			inline constexpr unsigned json_option_bits_width<options::ExecModeTypes> =
-			  2;
+			  3;
 
 			template<>
 			inline constexpr auto default_json_option_value<options::ExecModeTypes> =
@@ -157,6 +161,66 @@ namespace daw::json {
 			  default_json_option_value<options::ExcludeSpecialEscapes> =
 			    options::ExcludeSpecialEscapes::no;
 
+			template<>
+			inline constexpr unsigned
+			  json_option_bits_width<options::StructuralIndex> = 1;
+
+			template<>
+			inline constexpr auto
+			  default_json_option_value<options::StructuralIndex> =
+			    options::StructuralIndex::no;
+
+			template<>
+			inline constexpr unsigned
+			  json_option_bits_width<options::MemberNameLookup> = 1;
+
+			template<>
+			inline constexpr auto
+			  default_json_option_value<options::MemberNameLookup> =
+			    options::MemberNameLookup::hash;
+
+			template<>
+			inline constexpr unsigned
+			  json_option_bits_width<options::ExpectOrderedMembers> = 1;
+
+			template<>
+			inline constexpr auto
+			  default_json_option_value<options::ExpectOrderedMembers> =
+			    options::ExpectOrderedMembers::no;
+
+			template<>
+			inline constexpr unsigned
+			  json_option_bits_width<options::LearnMemberOrder> = 1;
+
+			template<>
+			inline constexpr auto
+			  default_json_option_value<options::LearnMemberOrder> =
+			    options::LearnMemberOrder::no;
+
+			template<>
+			inline constexpr unsigned json_option_bits_width<options::PaddedInput> =
+			  1;
+
+			template<>
+			inline constexpr auto default_json_option_value<options::PaddedInput> =
+			  options::PaddedInput::no;
+
+			template<>
+			inline constexpr unsigned json_option_bits_width<options::ValidateUTF8> =
+			  2;
+
+			template<>
+			inline constexpr auto default_json_option_value<options::ValidateUTF8> =
+			  options::ValidateUTF8::no;
+
+			template<>
+			inline constexpr unsigned json_option_bits_width<options::InSituStrings> =
+			  1;
+
+			template<>
+			inline constexpr auto default_json_option_value<options::InSituStrings> =
+			  options::InSituStrings::no;
+
 			using policy_list = typename option_list_impl<
 			  options::ExecModeTypes, options::ZeroTerminatedString,
 			  options::PolicyCommentTypes, options::CheckedParseMode,
@@ -164,7 +228,10 @@ namespace daw::json {
 			  options::ForceFullNameCheck, options::MinifiedDocument,
 			  options::UseExactMappingsByDefault, options::TemporarilyMutateBuffer,
 			  options::MustVerifyEndOfDataIsValid, options::ExcludeSpecialEscapes,
-			  options::ExpectLongNames>::type;
+			  options::ExpectLongNames, options::StructuralIndex,
+			  options::MemberNameLookup, options::ExpectOrderedMembers,
+			  options::LearnMemberOrder, options::PaddedInput,
+			  options::ValidateUTF8, options::InSituStrings>::type;
 
 			template<typename Policy, typename Policies>
 			inline constexpr unsigned basic_policy_bits_start =
@@ -19,6 +19,7 @@
 #include "daw_json_parse_policy_no_comments.h"
 #include "daw_json_parse_policy_policy_details.h"
 #include "daw_json_string_util.h"
+#include "daw_json_structural_index.h"
 
 #include <daw/cpp_17.h>
 #include <daw/daw_attributes.h>
@@ -33,6 +34,18 @@
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/***
+			 * see options::StructuralIndex.  The index does not know about comments
+			 */
+			template<json_options_t PolicyFlags>
+			inline constexpr bool use_structural_index_v =
+			  get_bits_for<options::StructuralIndex>( PolicyFlags ) ==
+			    options::StructuralIndex::yes and
+			  get_bits_for<options::PolicyCommentTypes>( PolicyFlags ) ==
+			    options::PolicyCommentTypes::none;
+		} // namespace json_details
+
 		/// @brief Handles the bounds and policy items for parsing execution and
 		/// comments.
 		/// @tparam PolicyFlags set via parse_options method to change compile time
@@ -45,7 +58,10 @@ namespace daw::json {
 		///
 		template<json_options_t PolicyFlags = json_details::default_policy_flag,
 		         typename Allocator = json_details::NoAllocator>
-		struct BasicParsePolicy : json_details::AllocatorWrapper<Allocator> {
+		struct BasicParsePolicy
+		  : json_details::AllocatorWrapper<Allocator>,
+		    json_details::StructuralIndexWrapper<
+		      json_details::use_structural_index_v<PolicyFlags>> {
 
 			static DAW_CONSTEVAL json_options_t policy_flags( ) {
 				return PolicyFlags;
@@ -60,7 +76,15 @@ namespace daw::json {
 				         PolicyFlags ) == options::TemporarilyMutateBuffer::yes;
 			}
 
-			using CharT = std::conditional_t<allow_temporarily_mutating_buffer( ),
+			/***
+			 * see options::InSituStrings
+			 */
+			static constexpr bool is_in_situ_strings =
+			  json_details::get_bits_for<options::InSituStrings>( PolicyFlags ) ==
+			  options::InSituStrings::yes;
+
+			using CharT = std::conditional_t<( allow_temporarily_mutating_buffer( ) or
+			                                   is_in_situ_strings ),
 			                                 char, char const>;
 			using iterator = CharT *;
 
@@ -77,10 +101,38 @@ namespace daw::json {
 			using exec_tag_t =
 			  switch_t<json_details::get_bits_for<options::ExecModeTypes,
 			                                      std::size_t>( PolicyFlags ),
-			           constexpr_exec_tag, runtime_exec_tag, simd_exec_tag>;
+			           constexpr_exec_tag, runtime_exec_tag, simd_exec_tag,
+			           avx2_exec_tag, dispatch_exec_tag>;
 
 			static constexpr exec_tag_t exec_tag = exec_tag_t{ };
 
+			/***
+			 * See options::PaddedInput
+			 */
+			static constexpr bool is_padded_input =
+			  json_details::get_bits_for<options::PaddedInput>( PolicyFlags ) ==
+			  options::PaddedInput::yes;
+
+			/***
+			 * The exec tag passed to the string and character search kernels.  With
+			 * options::PaddedInput the SIMD kernels read full blocks past the end
+			 */
+#if defined( DAW_ALLOW_SSE42 )
+			static constexpr bool is_simd_exec_mode =
+			  std::is_base_of_v<sse42_exec_tag, exec_tag_t>;
+
+			using kernel_exec_tag_t =
+			  std::conditional_t<( is_padded_input and is_simd_exec_mode ),
+			                     padded_exec_tag<exec_tag_t>, exec_tag_t>;
+#else
+			static constexpr bool is_simd_exec_mode = false;
+
+			using kernel_exec_tag_t = exec_tag_t;
+#endif
+
+			static constexpr kernel_exec_tag_t kernel_exec_tag =
+			  kernel_exec_tag_t{ };
+
 			/***
 			 * see options::AllowEscapedNames
 			 */
@@ -97,6 +149,44 @@ namespace daw::json {
 				         PolicyFlags ) == options::ForceFullNameCheck::yes;
 			}
 
+			/***
+			 * see options::MemberNameLookup
+			 */
+			static DAW_CONSTEVAL bool use_length_prefix_names( ) {
+				return json_details::get_bits_for<options::MemberNameLookup>(
+				         PolicyFlags ) == options::MemberNameLookup::length_prefix;
+			}
+
+			/***
+			 * see options::ExpectOrderedMembers
+			 */
+			static DAW_CONSTEVAL bool expect_ordered_members( ) {
+				return json_details::get_bits_for<options::ExpectOrderedMembers>(
+				         PolicyFlags ) == options::ExpectOrderedMembers::yes;
+			}
+
+			/***
+			 * see options::LearnMemberOrder
+			 */
+			static DAW_CONSTEVAL bool learn_member_order( ) {
+				return json_details::get_bits_for<options::LearnMemberOrder>(
+				         PolicyFlags ) == options::LearnMemberOrder::yes;
+			}
+
+			/***
+			 * see options::ValidateUTF8
+			 */
+			static constexpr bool is_validate_utf8_values =
+			  json_details::get_bits_for<options::ValidateUTF8>( PolicyFlags ) !=
+			  options::ValidateUTF8::no;
+
+			/***
+			 * see options::ValidateUTF8
+			 */
+			static constexpr bool is_validate_utf8_names =
+			  json_details::get_bits_for<options::ValidateUTF8>( PolicyFlags ) ==
+			  options::ValidateUTF8::values_and_names;
+
 			/***
 			 * see options::ZeroTerminatedString
 			 */
@@ -146,6 +236,12 @@ namespace daw::json {
 			  json_details::get_bits_for<options::ExpectLongNames>( PolicyFlags ) ==
 			  options::ExpectLongNames::yes;
 
+			/***
+			 * See options::StructuralIndex
+			 */
+			static constexpr bool has_structural_index =
+			  json_details::use_structural_index_v<PolicyFlags>;
+
 			using CommentPolicy =
 			  switch_t<json_details::get_bits_for<options::PolicyCommentTypes,
 			                                      std::size_t>( PolicyFlags ),
@@ -241,6 +337,7 @@ namespace daw::json {
 					auto result = with_allocator( first, last, class_first, class_last,
 					                              p.get_allocator( ) );
 					result.counter = p.counter;
+					result.set_structural_index( p.get_structural_index( ) );
 					return result;
 				}
 			}
@@ -251,6 +348,7 @@ namespace daw::json {
 				auto result =
 				  with_allocator( first, last, class_first, class_last, alloc );
 				result.counter = counter;
+				result.set_structural_index( this->get_structural_index( ) );
 				return result;
 			}
 
@@ -507,6 +605,12 @@ namespace daw::json {
 			}
 
 			[[nodiscard]] inline constexpr BasicParsePolicy skip_class( ) {
+				if constexpr( has_structural_index ) {
+					auto result = BasicParsePolicy( );
+					if( json_details::skip_bracketed_item_indexed<'{'>( *this, result ) ) {
+						return result;
+					}
+				}
 				if constexpr( is_unchecked_input ) {
 					return skip_bracketed_item_unchecked<'{', '}', '[', ']'>( );
 				} else {
@@ -515,6 +619,12 @@ namespace daw::json {
 			}
 
 			[[nodiscard]] inline constexpr BasicParsePolicy skip_array( ) {
+				if constexpr( has_structural_index ) {
+					auto result = BasicParsePolicy( );
+					if( json_details::skip_bracketed_item_indexed<'['>( *this, result ) ) {
+						return result;
+					}
+				}
 				if constexpr( is_unchecked_input ) {
 					return skip_bracketed_item_unchecked<'[', ']', '{', '}'>( );
 				} else {
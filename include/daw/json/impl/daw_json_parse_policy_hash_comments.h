@@ -59,10 +59,41 @@ namespace daw::json {
 				}
 			}
 
+#if defined( DAW_ALLOW_SSE42 )
+			/***
+			 * Skip the whitespace and comments with the SIMD kernels.  Runs of
+			 * whitespace and the ends of comments are found a block at a time
+			 */
+			template<typename ParseState>
+			DAW_ATTRIB_INLINE static void
+			skip_whitespace_and_comments_simd( ParseState &parse_state ) {
+				using CharT = typename ParseState::CharT;
+				CharT *first = parse_state.first;
+				CharT *const last = parse_state.last;
+				while( true ) {
+					first = json_details::mem_skip_whitespace(
+					  ParseState::kernel_exec_tag, first, last );
+					if( first >= last or *first != '#' ) {
+						break;
+					}
+					// The newline is skipped with the whitespace
+					first = json_details::mem_move_to_next_of<false, '\n'>(
+					  ParseState::kernel_exec_tag, first + 1, last );
+				}
+				parse_state.first = first;
+			}
+#endif
+
 		public:
 			template<typename ParseState>
 			DAW_ATTRIB_FLATINLINE static constexpr void
 			trim_left_checked( ParseState &parse_state ) {
+#if defined( DAW_ALLOW_SSE42 )
+				if constexpr( ParseState::is_simd_exec_mode ) {
+					skip_whitespace_and_comments_simd( parse_state );
+					return;
+				}
+#endif
 				skip_comments_checked( parse_state );
 				while( parse_state.has_more( ) and parse_state.is_space_unchecked( ) ) {
 					parse_state.remove_prefix( );
@@ -73,9 +104,16 @@ namespace daw::json {
 			template<typename ParseState>
 			DAW_ATTRIB_FLATINLINE static constexpr void
 			trim_left_unchecked( ParseState &parse_state ) {
+#if defined( DAW_ALLOW_SSE42 )
+				if constexpr( ParseState::is_simd_exec_mode ) {
+					skip_whitespace_and_comments_simd( parse_state );
+					return;
+				}
+#endif
 				skip_comments_unchecked( parse_state );
 				while( parse_state.is_space_unchecked( ) ) {
 					parse_state.remove_prefix( );
+					skip_comments_unchecked( parse_state );
 				}
 			}
 
@@ -133,8 +171,8 @@ namespace daw::json {
 						if constexpr( traits::not_same_v<typename ParseState::exec_tag_t,
 						                                 constexpr_exec_tag> ) {
 							ptr_first = json_details::mem_skip_until_end_of_string<
-							  ParseState::is_unchecked_input>( ParseState::exec_tag,
-							                                   ptr_first, parse_state.last );
+							  ParseState::is_unchecked_input>(
+							  ParseState::kernel_exec_tag, ptr_first, parse_state.last );
 						} else {
 							while( DAW_LIKELY( ptr_first < ptr_last ) and
 							       *ptr_first != '"' ) {
@@ -225,8 +263,8 @@ namespace daw::json {
 						if constexpr( traits::not_same_v<typename ParseState::exec_tag_t,
 						                                 constexpr_exec_tag> ) {
 							ptr_first = json_details::mem_skip_until_end_of_string<
-							  ParseState::is_unchecked_input>( ParseState::exec_tag,
-							                                   ptr_first, parse_state.last );
+							  ParseState::is_unchecked_input>(
+							  ParseState::kernel_exec_tag, ptr_first, parse_state.last );
 						} else {
 							while( *ptr_first != '"' ) {
 								if( *ptr_first == '\\' ) {
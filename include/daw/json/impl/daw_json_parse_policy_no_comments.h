@@ -34,9 +34,15 @@ namespace daw::json {
 			trim_left_checked( ParseState &parse_state ) {
 				if constexpr( ParseState::minified_document( ) ) {
 					return;
+				} else if constexpr( std::is_same_v<typename ParseState::exec_tag_t,
+				                                    dispatch_exec_tag> or
+				                     ParseState::is_simd_exec_mode ) {
+					// The kernels check the first character before going wide, most
+					// JSON has very minimal whitespace
+					parse_state.first = json_details::mem_skip_whitespace(
+					  ParseState::kernel_exec_tag, parse_state.first, parse_state.last );
 				} else {
 					using CharT = typename ParseState::CharT;
-					// SIMD here was much slower, most JSON has very minimal whitespace
 					CharT *first = parse_state.first;
 					CharT *const last = parse_state.last;
 
@@ -68,6 +74,11 @@ namespace daw::json {
 			trim_left_unchecked( ParseState &parse_state ) {
 				if constexpr( ParseState::minified_document( ) ) {
 					return;
+				} else if constexpr( std::is_same_v<typename ParseState::exec_tag_t,
+				                                    dispatch_exec_tag> or
+				                     ParseState::is_simd_exec_mode ) {
+					parse_state.first = json_details::mem_skip_whitespace(
+					  ParseState::kernel_exec_tag, parse_state.first, parse_state.last );
 				} else {
 					using CharT = typename ParseState::CharT;
 					CharT *first = parse_state.first;
@@ -98,8 +109,14 @@ namespace daw::json {
 
 				using CharT = typename ParseState::CharT;
 
-				if constexpr( traits::not_same<typename ParseState::exec_tag_t,
-				                               constexpr_exec_tag>::value ) {
+				if constexpr( std::is_same_v<typename ParseState::exec_tag_t,
+				                             dispatch_exec_tag> ) {
+					parse_state.first =
+					  json_details::mem_move_to_next_of<ParseState::is_unchecked_input,
+					                                    keys...>(
+					    ParseState::exec_tag, parse_state.first, parse_state.last );
+				} else if constexpr( traits::not_same<typename ParseState::exec_tag_t,
+				                                      constexpr_exec_tag>::value ) {
 					parse_state.first =
 					  json_details::mempbrk<ParseState::is_unchecked_input,
 					                        typename ParseState::exec_tag_t,
@@ -172,7 +189,7 @@ namespace daw::json {
 							                               constexpr_exec_tag>::value ) {
 								ptr_first = json_details::mem_skip_until_end_of_string<
 								  ParseState::is_unchecked_input>(
-								  ParseState::exec_tag, ptr_first, parse_state.last );
+								  ParseState::kernel_exec_tag, ptr_first, parse_state.last );
 							} else {
 								char c = *ptr_first;
 								while( ( c != '\0' ) & ( c != '"' ) ) {
@@ -235,7 +252,7 @@ namespace daw::json {
 							                               constexpr_exec_tag>::value ) {
 								ptr_first = json_details::mem_skip_until_end_of_string<
 								  ParseState::is_unchecked_input>(
-								  ParseState::exec_tag, ptr_first, parse_state.last );
+								  ParseState::kernel_exec_tag, ptr_first, parse_state.last );
 							} else {
 								while( DAW_LIKELY( ptr_first < ptr_last ) and
 								       *ptr_first != '"' ) {
@@ -321,8 +338,8 @@ namespace daw::json {
 						if constexpr( traits::not_same<typename ParseState::exec_tag_t,
 						                               constexpr_exec_tag>::value ) {
 							ptr_first = json_details::mem_skip_until_end_of_string<
-							  ParseState::is_unchecked_input>( ParseState::exec_tag,
-							                                   ptr_first, parse_state.last );
+							  ParseState::is_unchecked_input>(
+							  ParseState::kernel_exec_tag, ptr_first, parse_state.last );
 						} else {
 							while( *ptr_first != '"' ) {
 								if( *ptr_first == '\\' ) {
@@ -13,6 +13,7 @@
 #include "daw_fp_fallback.h"
 #include "daw_json_assert.h"
 #include "daw_json_parse_policy_policy_details.h"
+#include "daw_json_parse_real_eisel_lemire.h"
 #include "daw_json_parse_real_power10.h"
 #include "daw_json_parse_unsigned_int.h"
 #include "daw_json_skip.h"
@@ -45,6 +46,13 @@ namespace daw::json {
 						dig = parse_digit( *first );
 					}
 				} else {
+					if constexpr( std::is_integral_v<Unsigned> ) {
+						while( last - first >= 8 ) {
+							value *= 100'000'000U;
+							value += static_cast<Unsigned>( parse_8_digits( first ) );
+							first += 8;
+						}
+					}
 					while( DAW_LIKELY( first < last ) ) {
 						value *= 10U;
 						value += parse_digit( *first );
@@ -64,6 +72,14 @@ namespace daw::json {
 				(void)last;
 
 				Unsigned value = v;
+				if constexpr( std::is_integral_v<Unsigned> ) {
+					// Convert runs of eight digits at a time
+					while( last - first >= 8 and is_made_of_eight_digits_cx( first ) ) {
+						value *= 100'000'000U;
+						value += static_cast<Unsigned>( parse_8_digits( first ) );
+						first += 8;
+					}
+				}
 				if constexpr( skip_end_check ) {
 					for( auto dig = parse_digit( *first ); dig < 10U;
 					     ++first, dig = parse_digit( *first ) ) {
@@ -83,6 +99,30 @@ namespace daw::json {
 				return first;
 			}
 
+			/***
+			 * The number of significand digits parsed before the rest are
+			 * truncated, and the range where power10 is exact because both the
+			 * significand and the power of ten are exactly representable in Result
+			 */
+			template<typename Result>
+			struct real_parse_bounds {
+				static constexpr std::int64_t max_digits =
+				  daw::numeric_limits<Result>::max_digits10 + 1;
+				static constexpr std::int64_t max_exact_power10 = 22;
+				static constexpr std::uint64_t max_exact_significand =
+				  9007199254740992ULL;
+			};
+
+			template<>
+			struct real_parse_bounds<float> {
+				// Keep all the digits that fit in the std::uint64_t significand,
+				// Eisel-Lemire rounds them to float exactly
+				static constexpr std::int64_t max_digits =
+				  daw::numeric_limits<std::uint64_t>::digits10;
+				static constexpr std::int64_t max_exact_power10 = 10;
+				static constexpr std::uint64_t max_exact_significand = 16777216ULL;
+			};
+
 			template<typename ParseState, typename Result,
 			         typename max_storage_digits, typename CharT>
 			inline constexpr bool
@@ -149,8 +189,9 @@ namespace daw::json {
 					}
 					return static_cast<Result>( 1.0 );
 				}( );
-				using max_exponent = daw::constant<static_cast<std::ptrdiff_t>(
-				  daw::numeric_limits<Result>::max_digits10 + 1 )>;
+				using bounds = real_parse_bounds<Result>;
+				using max_exponent =
+				  daw::constant<static_cast<std::ptrdiff_t>( bounds::max_digits )>;
 				using unsigned_t =
 				  std::conditional_t<max_storage_digits::value >= max_exponent::value,
 				                     std::uint64_t, Result>;
@@ -170,6 +211,9 @@ namespace daw::json {
 					fract_exponent_available = 0;
 					fract_first = nullptr;
 					exponent = whole_exponent_available;
+					if constexpr( ParseState::precise_ieee754( ) ) {
+						use_strtod = true;
+					}
 				} else {
 					whole_exponent_available =
 					  max_exponent::value - whole_exponent_available;
@@ -245,14 +289,24 @@ namespace daw::json {
 				}
 				if constexpr( std::is_floating_point_v<Result> and
 				              ParseState::precise_ieee754( ) ) {
-					use_strtod |= DAW_UNLIKELY( exponent > 22 );
-					use_strtod |= DAW_UNLIKELY( exponent < -22 );
-					use_strtod |=
-					  DAW_UNLIKELY( significant_digits > 9007199254740992ULL );
 					if( DAW_UNLIKELY( use_strtod ) ) {
+						// Digits were truncated, the significand is not exact
 						return json_details::parse_with_strtod<Result>( parse_state.first,
 						                                                parse_state.last );
 					}
+					if( DAW_UNLIKELY(
+					      exponent > bounds::max_exact_power10 or
+					      exponent < -bounds::max_exact_power10 or
+					      significant_digits > bounds::max_exact_significand ) ) {
+						if constexpr( has_eisel_lemire_v<Result> and
+						              std::is_same_v<unsigned_t, std::uint64_t> ) {
+							return sign * eisel_lemire<Result>( significant_digits,
+							                                    exponent );
+						} else {
+							return json_details::parse_with_strtod<Result>(
+							  parse_state.first, parse_state.last );
+						}
+					}
 				}
 				return sign * power10<Result>(
 				                ParseState::exec_tag,
@@ -283,8 +337,9 @@ namespace daw::json {
 
 				using max_storage_digits = daw::constant<static_cast<std::int64_t>(
 				  daw::numeric_limits<std::uint64_t>::digits10 )>;
-				using max_exponent = daw::constant<static_cast<std::int64_t>(
-				  daw::numeric_limits<Result>::max_digits10 + 1 )>;
+				using bounds = real_parse_bounds<Result>;
+				using max_exponent =
+				  daw::constant<static_cast<std::int64_t>( bounds::max_digits )>;
 				using unsigned_t =
 				  std::conditional_t<max_storage_digits::value >= max_exponent::value,
 				                     std::uint64_t, Result>;
@@ -447,14 +502,24 @@ namespace daw::json {
 
 				if constexpr( std::is_floating_point_v<Result> and
 				              ParseState::precise_ieee754( ) ) {
-					use_strtod |= DAW_UNLIKELY( exponent > 22 );
-					use_strtod |= DAW_UNLIKELY( exponent < -22 );
-					use_strtod |=
-					  DAW_UNLIKELY( significant_digits > 9007199254740992ULL );
 					if( DAW_UNLIKELY( use_strtod ) ) {
+						// Digits were truncated, the significand is not exact
 						return json_details::parse_with_strtod<Result>( orig_first,
 						                                                orig_last );
 					}
+					if( DAW_UNLIKELY(
+					      exponent > bounds::max_exact_power10 or
+					      exponent < -bounds::max_exact_power10 or
+					      significant_digits > bounds::max_exact_significand ) ) {
+						if constexpr( has_eisel_lemire_v<Result> and
+						              std::is_same_v<unsigned_t, std::uint64_t> ) {
+							return sign * eisel_lemire<Result>( significant_digits,
+							                                    exponent );
+						} else {
+							return json_details::parse_with_strtod<Result>( orig_first,
+							                                                orig_last );
+						}
+					}
 				}
 				return sign * power10<Result>(
 				                ParseState::exec_tag,
@@ -12,36 +12,63 @@
 
 #include "daw_json_assert.h"
 #include "daw_json_parse_common.h"
+#include "daw_json_utf8.h"
 #include "daw_not_const_ex_functions.h"
 
 #include <daw/daw_likely.h>
 
+#include <algorithm>
+#include <array>
 #include <ciso646>
+#include <cstdint>
 #include <string>
 #include <type_traits>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
 		namespace json_details {
-			[[nodiscard]] inline constexpr UInt8 to_nibble( unsigned char chr ) {
-				int const b = static_cast<int>( chr );
-				int const maskLetter = ( ( '9' - b ) >> 31 );
-				int const maskSmall = ( ( 'Z' - b ) >> 31 );
-				int const offset = '0' + ( maskLetter & int( 'A' - '0' - 10 ) ) +
-				                   ( maskSmall & int( 'a' - 'A' ) );
-				auto const result = static_cast<unsigned>( b - offset );
-				return to_uint8( result );
+			/***
+			 * Convert the four hex digits at ptr to their value, all four at once
+			 * in a 32bit word.  The digits are checked with the byte range test
+			 * from Bit Twiddling Hacks, hasbetween, which is exact for bytes below
+			 * 0x80
+			 */
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::uint32_t
+			hex4_to_u32( char const *ptr, bool &is_valid ) {
+				std::uint32_t word = 0;
+				for( unsigned n = 0; n < 4U; ++n ) {
+					auto const c = static_cast<unsigned char>( ptr[n] );
+					word |= static_cast<std::uint32_t>( c ) << ( 8U * n );
+				}
+				constexpr std::uint32_t ones = 0x0101'0101U;
+				constexpr std::uint32_t high = 0x8080'8080U;
+				constexpr std::uint32_t low7 = 0x7F7F'7F7FU;
+				// The high bit of each byte that is strictly between m and n
+				constexpr auto between = []( std::uint32_t x, std::uint32_t m,
+				                             std::uint32_t n ) {
+					return ( ones * ( 127U + n ) - ( x & low7 ) ) & ~x &
+					       ( ( x & low7 ) + ones * ( 127U - m ) ) & high;
+				};
+				std::uint32_t const digits = between( word, 0x2FU, 0x3AU );
+				std::uint32_t const letters =
+				  between( word | 0x2020'2020U, 0x60U, 0x67U );
+				is_valid = ( ( digits | letters ) == high ) & ( ( word & high ) == 0 );
+				// Letters have 0x40 set, and their low nibble is 9 less than the value
+				std::uint32_t const nibbles =
+				  ( word & 0x0F0F'0F0FU ) + ( ( word & 0x4040'4040U ) >> 6U ) * 9U;
+				std::uint32_t const pairs = ( ( nibbles & 0x000F'000FU ) << 4U ) |
+				                            ( ( nibbles >> 8U ) & 0x000F'000FU );
+				return ( ( pairs & 0xFFU ) << 8U ) | ( ( pairs >> 16U ) & 0xFFU );
 			}
 
-			template<bool is_unchecked_input>
-			[[nodiscard]] inline constexpr UInt16
-			byte_from_nibbles( char const *&first ) {
-				auto const n0 = to_nibble( static_cast<unsigned char>( *first++ ) );
-				auto const n1 = to_nibble( static_cast<unsigned char>( *first++ ) );
-				if constexpr( is_unchecked_input ) {
-					daw_json_ensure( n0 < 16 and n1 < 16, ErrorReason::InvalidUTFEscape );
-				}
-				return to_uint16( ( n0 << 4U ) | n1 );
+			template<typename ParseState, typename CharT>
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr UInt32
+			parse_hex4( ParseState const &parse_state, CharT *&first ) {
+				bool is_valid = false;
+				auto const result = hex4_to_u32( first, is_valid );
+				daw_json_ensure( is_valid, ErrorReason::InvalidUTFEscape, parse_state );
+				first += 4;
+				return to_uint32( result );
 			}
 
 			constexpr char u32toC( UInt32 value ) {
@@ -51,14 +78,11 @@ namespace daw::json {
 			template<typename ParseState>
 			[[nodiscard]] static constexpr char *
 			decode_utf16( ParseState &parse_state, char *it ) {
-				constexpr bool is_unchecked_input = ParseState::is_unchecked_input;
 				daw_json_assert_weak( parse_state.size( ) >= 5,
 				                      ErrorReason::UnexpectedEndOfData, parse_state );
-				char const *first = parse_state.first;
+				auto first = parse_state.first;
 				++first;
-				UInt32 cp = to_uint32( byte_from_nibbles<is_unchecked_input>( first ) )
-				            << 8U;
-				cp |= byte_from_nibbles<is_unchecked_input>( first );
+				UInt32 cp = parse_hex4( parse_state, first );
 				if( cp <= 0x7FU ) {
 					*it++ = static_cast<char>( static_cast<unsigned char>( cp ) );
 					parse_state.first = first;
@@ -74,9 +98,7 @@ namespace daw::json {
 					  ErrorReason::InvalidUTFEscape,
 					  parse_state ); // Expected parse_state to start with a \\u
 					++first;
-					auto trailing =
-					  to_uint32( byte_from_nibbles<is_unchecked_input>( first ) ) << 8U;
-					trailing |= byte_from_nibbles<is_unchecked_input>( first );
+					auto trailing = parse_hex4( parse_state, first );
 					trailing -= 0xDC00U;
 					cp += trailing;
 					cp += 0x10000;
@@ -124,12 +146,9 @@ namespace daw::json {
 			template<typename ParseState, typename Appender>
 			static constexpr void decode_utf16( ParseState &parse_state,
 			                                    Appender &app ) {
-				constexpr bool is_unchecked_input = ParseState::is_unchecked_input;
-				char const *first = parse_state.first;
+				auto first = parse_state.first;
 				++first;
-				UInt32 cp = to_uint32( byte_from_nibbles<is_unchecked_input>( first ) )
-				            << 8U;
-				cp |= byte_from_nibbles<is_unchecked_input>( first );
+				UInt32 cp = parse_hex4( parse_state, first );
 				if( cp <= 0x7FU ) {
 					app( u32toC( cp ) );
 					parse_state.first = first;
@@ -141,9 +160,7 @@ namespace daw::json {
 					daw_json_assert_weak( *first == 'u', ErrorReason::InvalidUTFEscape,
 					                      parse_state );
 					++first;
-					auto trailing =
-					  to_uint32( byte_from_nibbles<is_unchecked_input>( first ) ) << 8U;
-					trailing |= byte_from_nibbles<is_unchecked_input>( first );
+					auto trailing = parse_hex4( parse_state, first );
 					trailing -= 0xDC00U;
 					cp += trailing;
 					cp += 0x10000;
@@ -185,9 +202,56 @@ namespace daw::json {
 				parse_state.first = first;
 			}
 
+			/***
+			 * Ensure that the string data in [first, last) is valid UTF-8.  Escapes
+			 * are ASCII and are checked as is.  See options::ValidateUTF8
+			 */
+			template<typename ParseState>
+			DAW_ATTRIB_INLINE constexpr void
+			ensure_valid_utf8( ParseState const &parse_state, char const *first,
+			                   char const *last ) {
+				daw_json_ensure( is_valid_utf8( ParseState::exec_tag, first, last ),
+				                 ErrorReason::InvalidUTFCodepoint, parse_state );
+			}
+
+			/***
+			 * Ensure that no character in [first, last) has the high bit set.  See
+			 * options::EightBitModes::DisallowHigh
+			 */
+			template<typename ParseState>
+			DAW_ATTRIB_INLINE constexpr void
+			ensure_no_high_eight( ParseState const &parse_state, char const *first,
+			                      char const *last ) {
+				if constexpr( not ParseState::is_unchecked_input ) {
+					for( ; first < last; ++first ) {
+						daw_json_assert_weak( static_cast<unsigned char>( *first ) <= 0x7FU,
+						                      ErrorReason::InvalidStringHighASCII,
+						                      parse_state );
+					}
+				}
+			}
+
 			namespace parse_tokens {
 				inline constexpr char const escape_quotes[] = "\\\"";
-			}
+
+				/***
+				 * The character that the escape of c decodes to, indexed by c.  The
+				 * characters that are not single character escapes decode to
+				 * themselves
+				 */
+				inline constexpr auto unescape_table = [] {
+					auto result = std::array<char, 256>{ };
+					for( std::size_t n = 0; n < result.size( ); ++n ) {
+						result[n] = static_cast<char>( static_cast<unsigned char>( n ) );
+					}
+					result['b'] = '\b';
+					result['f'] = '\f';
+					result['n'] = '\n';
+					result['r'] = '\r';
+					result['t'] = '\t';
+					return result;
+				}( );
+			} // namespace parse_tokens
 
 			// Fast path for parsing escaped strings to a std::string with the default
 			// appender
@@ -209,6 +273,10 @@ namespace daw::json {
 				if( auto const first_slash =
 				      static_cast<std::ptrdiff_t>( parse_state.counter ) - 1;
 				    first_slash > 1 ) {
+					if constexpr( ParseState::is_validate_utf8_values ) {
+						ensure_valid_utf8( parse_state, parse_state.first,
+						                   parse_state.first + first_slash );
+					}
 					it = std::copy_n( parse_state.first, first_slash, it );
 					parse_state.first += first_slash;
 				}
@@ -222,75 +290,64 @@ namespace daw::json {
 
 				while( pred( parse_state ) ) {
 					{
-						char const *first = parse_state.first;
-						char const *const last = parse_state.last;
-						if constexpr( std::is_same<typename ParseState::exec_tag_t,
-						                           constexpr_exec_tag>::value ) {
+						auto first = parse_state.first;
+						auto const last = parse_state.last;
+#if defined( DAW_ALLOW_SSE42 )
+						if constexpr( ParseState::is_simd_exec_mode ) {
+							// Copy a block at a time while looking for the end of the run
+							first = mem_copy_to_next_of<'"', '\\'>( ParseState::exec_tag,
+							                                         first, last, it );
+						} else
+#endif
+						{
+							if constexpr( std::is_same<typename ParseState::exec_tag_t,
+							                           constexpr_exec_tag>::value ) {
 
-							daw_json_assert_weak( KnownBounds or first < last,
-							                      ErrorReason::UnexpectedEndOfData,
-							                      parse_state );
-							while( *first != '"' and *first != '\\' ) {
-								++first;
 								daw_json_assert_weak( KnownBounds or first < last,
 								                      ErrorReason::UnexpectedEndOfData,
 								                      parse_state );
+								while( *first != '"' and *first != '\\' ) {
+									++first;
+									daw_json_assert_weak( KnownBounds or first < last,
+									                      ErrorReason::UnexpectedEndOfData,
+									                      parse_state );
+								}
+							} else {
+								first = mem_move_to_next_of<
+								  ( ParseState::is_unchecked_input or
+								    ParseState::is_zero_terminated_string( ) ),
+								  '"', '\\'>( ParseState::kernel_exec_tag, first, last );
 							}
-						} else {
-							first = mem_move_to_next_of<
-							  ( ParseState::is_unchecked_input or
-							    ParseState::is_zero_terminated_string( ) ),
-							  '"', '\\'>( ParseState::exec_tag, first, last );
+							it = daw::algorithm::copy( parse_state.first, first, it );
+						}
+						if constexpr( ParseState::is_validate_utf8_values ) {
+							ensure_valid_utf8( parse_state, parse_state.first, first );
 						}
-						it = daw::algorithm::copy( parse_state.first, first, it );
 						parse_state.first = first;
 					}
 					if( parse_state.front( ) == '\\' ) {
-						parse_state.remove_prefix( );
-						daw_json_assert_weak( not parse_state.is_space_unchecked( ),
-						                      ErrorReason::InvalidUTFCodepoint,
-						                      parse_state );
-						switch( parse_state.front( ) ) {
-						case 'b':
-							*it++ = '\b';
-							parse_state.remove_prefix( );
-							break;
-						case 'f':
-							*it++ = '\f';
-							parse_state.remove_prefix( );
-							break;
-						case 'n':
-							*it++ = '\n';
-							parse_state.remove_prefix( );
-							break;
-						case 'r':
-							*it++ = '\r';
+						// Runs of escapes are decoded without going back to the search
+						do {
 							parse_state.remove_prefix( );
-							break;
-						case 't':
-							*it++ = '\t';
-							parse_state.remove_prefix( );
-							break;
-						case 'u':
-							it = decode_utf16( parse_state, it );
-							break;
-						case '/':
-						case '\\':
-						case '"':
-							*it++ = parse_state.front( );
-							parse_state.remove_prefix( );
-							break;
-						default:
-							if constexpr( not AllowHighEight ) {
-								daw_json_assert_weak(
-								  ( not parse_state.is_space_unchecked( ) ) &
-								    ( static_cast<unsigned char>( parse_state.front( ) ) <=
-								      0x7FU ),
-								  ErrorReason::InvalidStringHighASCII, parse_state );
+							daw_json_assert_weak( not parse_state.is_space_unchecked( ),
+							                      ErrorReason::InvalidUTFCodepoint,
+							                      parse_state );
+							char const c = parse_state.front( );
+							if( c == 'u' ) {
+								it = decode_utf16( parse_state, it );
+							} else {
+								if constexpr( not AllowHighEight ) {
+									daw_json_assert_weak(
+									  static_cast<unsigned char>( c ) <= 0x7FU,
+									  ErrorReason::InvalidStringHighASCII, parse_state );
+								}
+								auto const idx = static_cast<unsigned char>( c );
+								*it++ = parse_tokens::unescape_table[idx];
+								parse_state.remove_prefix( );
 							}
-							*it++ = parse_state.front( );
-							parse_state.remove_prefix( );
-						}
+						} while( ( ParseState::is_unchecked_input or
+						           parse_state.has_more( ) ) and
+						         parse_state.front( ) == '\\' );
 					} else {
 						daw_json_assert_weak( not has_quote or
 						                        parse_state.is_quotes_checked( ),
@@ -314,6 +371,75 @@ namespace daw::json {
 					  std::data( result ), daw::data_end( result ) );
 				}
 			}
+
+			/***
+			 * @return The position of the first '\\' in [first, str.last), or
+			 * str.last when there is none
+			 */
+			template<typename ParseState, typename CharT>
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr CharT *
+			find_escape( ParseState const &str, CharT *first ) {
+				CharT *const last = str.last;
+				if constexpr( std::is_same<typename ParseState::exec_tag_t,
+				                           constexpr_exec_tag>::value ) {
+					while( first < last and *first != '\\' ) {
+						++first;
+					}
+					return first;
+				} else {
+					return mem_move_to_next_of<false, '\\'>( ParseState::kernel_exec_tag,
+					                                          first, last );
+				}
+			}
+
+			/***
+			 * Decode the escapes of the string in [str.first, str.last) to out.  The
+			 * decoded text is never longer than the escaped text, so out can be
+			 * str.first and the string is decoded in place
+			 * @return The end of the decoded text
+			 */
+			template<typename ParseState>
+			[[nodiscard]] constexpr char *decode_string_to( ParseState str,
+			                                                char *out ) {
+				auto first = find_escape( str, str.first );
+				auto const last = str.last;
+				char *it = out + ( first - str.first );
+				if( out != str.first ) {
+					std::copy( str.first, first, out );
+				}
+				while( first < last ) {
+					++first;
+					daw_json_assert_weak( first < last, ErrorReason::InvalidString,
+					                      str );
+					char const c = *first;
+					if( c == 'u' ) {
+						str.first = first;
+						it = decode_utf16( str, it );
+						first = str.first;
+					} else {
+						*it++ =
+						  parse_tokens::unescape_table[static_cast<unsigned char>( c )];
+						++first;
+					}
+					// When decoding in place the runs between escapes move towards the
+					// start of the string, so a forward copy is safe
+					auto const run_last = find_escape( str, first );
+					it = std::copy( first, run_last, it );
+					first = run_last;
+				}
+				return it;
+			}
+
+			/***
+			 * Decode the escapes of the string in [str.first, str.last) in place.
+			 * See options::InSituStrings
+			 * @return The end of the decoded text
+			 */
+			template<typename ParseState>
+			[[nodiscard]] constexpr char *decode_string_in_situ( ParseState str ) {
+				static_assert( ParseState::is_in_situ_strings );
+				return decode_string_to( str, str.first );
+			}
 		} // namespace json_details
 	}   // namespace DAW_JSON_VER
 } // namespace daw::json
@@ -105,7 +105,7 @@ namespace daw::json {
 					if constexpr( traits::not_same_v<typename ParseState::exec_tag_t,
 					                                 constexpr_exec_tag> ) {
 						first = mem_skip_until_end_of_string<true>(
-						  ParseState::exec_tag, first, last, need_slow_path );
+						  ParseState::kernel_exec_tag, first, last, need_slow_path );
 					} else {
 
 						{
@@ -147,7 +147,7 @@ namespace daw::json {
 					if constexpr( traits::not_same_v<typename ParseState::exec_tag_t,
 					                                 constexpr_exec_tag> ) {
 						first = mem_skip_until_end_of_string<false>(
-						  ParseState::exec_tag, first, last, need_slow_path );
+						  ParseState::kernel_exec_tag, first, last, need_slow_path );
 					} else {
 						if constexpr( not ParseState::exclude_special_escapes( ) ) {
 							if( CharT *const l = parse_state.last; l - first >= 8 ) {
@@ -12,15 +12,18 @@
 
 #include "daw_json_assert.h"
 #include "daw_json_parse_array_iterator.h"
+#include "daw_json_parse_fixed_point.h"
 #include "daw_json_parse_kv_array_iterator.h"
 #include "daw_json_parse_kv_class_iterator.h"
 #include "daw_json_parse_name.h"
+#include "daw_json_parse_number_array.h"
 #include "daw_json_parse_real.h"
 #include "daw_json_parse_std_string.h"
 #include "daw_json_parse_string_need_slow.h"
 #include "daw_json_parse_string_quote.h"
 #include "daw_json_parse_unsigned_int.h"
 #include "daw_json_parse_value_fwd.h"
+#include "daw_json_string_intern_fwd.h"
 #include "daw_json_traits.h"
 #include "daw_json_value_fwd.h"
 
@@ -33,6 +36,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
 #include <tuple>
 
 #if defined( __cpp_constexpr_dynamic_alloc )
@@ -73,6 +79,134 @@ namespace daw::json {
 				}
 			}
 
+			/***
+			 * Parse a JSON number into an integer scaled by
+			 * 10^JsonMember::fixed_point_scale.  The whole and fraction digits are
+			 * accumulated as one integer, with the SWAR digit parsers, and the
+			 * exponent moves the decimal point.  Trailing zeros in the fraction are
+			 * not significant, any other digits past the scale are an error as the
+			 * value cannot be represented exactly
+			 */
+			template<typename JsonMember, bool KnownBounds, typename ParseState>
+			[[nodiscard]] constexpr json_result<JsonMember>
+			parse_fixed_point( ParseState &parse_state ) {
+				using constructor_t = typename JsonMember::constructor_t;
+				using element_t = typename JsonMember::base_type;
+				using CharT = typename ParseState::CharT;
+
+				if constexpr( not KnownBounds ) {
+					if constexpr( JsonMember::literal_as_string !=
+					              options::LiteralAsStringOpt::Never ) {
+						skip_quote_when_literal_as_string<JsonMember::literal_as_string>(
+						  parse_state );
+					}
+				}
+				bool const is_negative =
+				  parse_policy_details::validate_signed_first( parse_state ) < 0;
+				CharT *const last = parse_state.last;
+				CharT *whole_first = parse_state.first;
+				CharT *const whole_last = skip_fixed_point_digits( whole_first, last );
+				daw_json_assert_weak( whole_first != whole_last,
+				                      ErrorReason::InvalidNumber, parse_state );
+
+				CharT *frac_first = whole_last;
+				CharT *frac_last = whole_last;
+				if( frac_first < last and *frac_first == '.' ) {
+					++frac_first;
+					frac_last = skip_fixed_point_digits( frac_first, last );
+					daw_json_assert_weak( frac_first != frac_last,
+					                      ErrorReason::InvalidNumber, parse_state );
+				}
+				CharT *ptr = frac_last;
+				auto exponent =
+				  static_cast<std::ptrdiff_t>( JsonMember::fixed_point_scale );
+				if( ptr < last and ( *ptr == 'e' or *ptr == 'E' ) ) {
+					++ptr;
+					bool const is_exp_negative = ptr < last and *ptr == '-';
+					if( ptr < last and ( *ptr == '-' or *ptr == '+' ) ) {
+						++ptr;
+					}
+					CharT *const exp_last = skip_fixed_point_digits( ptr, last );
+					daw_json_assert_weak( ptr != exp_last, ErrorReason::InvalidNumber,
+					                      parse_state );
+					std::ptrdiff_t exp = 0;
+					for( ; ptr < exp_last; ++ptr ) {
+						// Anything this large is out of range or zero
+						if( exp < 10'000 ) {
+							exp *= 10;
+							exp += static_cast<std::ptrdiff_t>( parse_digit( *ptr ) );
+						}
+					}
+					exponent += is_exp_negative ? -exp : exp;
+				}
+				parse_state.first = ptr;
+
+				while( frac_last != frac_first and *( frac_last - 1 ) == '0' ) {
+					--frac_last;
+				}
+				exponent -= frac_last - frac_first;
+				while( whole_first != whole_last and *whole_first == '0' ) {
+					++whole_first;
+				}
+				if( whole_first == whole_last ) {
+					while( frac_first != frac_last and *frac_first == '0' ) {
+						++frac_first;
+					}
+				}
+				daw_json_ensure( ( whole_last - whole_first ) +
+				                     ( frac_last - frac_first ) <=
+				                   fixed_point_max_digits,
+				                 ErrorReason::NumberOutOfRange, parse_state );
+				std::uint64_t value = accumulate_fixed_point_digits(
+				  accumulate_fixed_point_digits( 0, whole_first, whole_last ),
+				  frac_first, frac_last );
+
+				if( value != 0 ) {
+					if( exponent < 0 ) {
+						daw_json_ensure( exponent >= -fixed_point_max_digits and
+						                   value % fixed_point_pow10[-exponent] == 0,
+						                 ErrorReason::NumberOutOfRange, parse_state );
+						value /= fixed_point_pow10[-exponent];
+					} else if( exponent > 0 ) {
+						daw_json_ensure(
+						  exponent <= fixed_point_max_digits and
+						    value <= ( daw::numeric_limits<std::uint64_t>::max )( ) /
+						               fixed_point_pow10[exponent],
+						  ErrorReason::NumberOutOfRange, parse_state );
+						value *= fixed_point_pow10[exponent];
+					}
+				}
+				auto const max_value =
+				  static_cast<std::uint64_t>(
+				    ( daw::numeric_limits<element_t>::max )( ) ) +
+				  ( is_negative ? 1U : 0U );
+				daw_json_ensure( value <= max_value, ErrorReason::NumberOutOfRange,
+				                 parse_state );
+				auto const parsed_val = static_cast<element_t>(
+				  static_cast<std::int64_t>( is_negative ? 0U - value : value ) );
+
+				if constexpr( KnownBounds ) {
+					return construct_value(
+					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
+					  parsed_val );
+				} else {
+					auto result = construct_value(
+					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
+					  parsed_val );
+					if constexpr( JsonMember::literal_as_string !=
+					              options::LiteralAsStringOpt::Never ) {
+						skip_quote_when_literal_as_string<JsonMember::literal_as_string>(
+						  parse_state );
+					}
+					parse_state.trim_left( );
+					daw_json_assert_weak(
+					  not parse_state.has_more( ) or
+					    parse_policy_details::at_end_of_item( parse_state.front( ) ),
+					  ErrorReason::InvalidEndOfValue, parse_state );
+					return result;
+				}
+			}
+
 			template<typename JsonMember, bool KnownBounds, typename ParseState>
 			[[nodiscard]] DAW_ATTRIB_INLINE constexpr json_result<JsonMember>
 			parse_value( ParseState &parse_state, ParseTag<JsonParseTypes::Real> ) {
@@ -159,7 +293,7 @@ namespace daw::json {
 
 			template<typename JsonMember, bool KnownBounds, typename ParseState>
 			[[nodiscard]] DAW_ATTRIB_INLINE constexpr json_result<JsonMember>
-			parse_value( ParseState &parse_state, ParseTag<JsonParseTypes::Signed> ) {
+			parse_signed( ParseState &parse_state ) {
 				using constructor_t = typename JsonMember::constructor_t;
 				using element_t = typename JsonMember::base_type;
 				using int_type =
@@ -216,6 +350,16 @@ namespace daw::json {
 				}
 			}
 
+			template<typename JsonMember, bool KnownBounds, typename ParseState>
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr json_result<JsonMember>
+			parse_value( ParseState &parse_state, ParseTag<JsonParseTypes::Signed> ) {
+				if constexpr( is_fixed_point_v<JsonMember> ) {
+					return parse_fixed_point<JsonMember, KnownBounds>( parse_state );
+				} else {
+					return parse_signed<JsonMember, KnownBounds>( parse_state );
+				}
+			}
+
 			template<typename JsonMember, bool KnownBounds, typename ParseState>
 			[[nodiscard]] DAW_ATTRIB_INLINE constexpr json_result<JsonMember>
 			parse_value( ParseState &parse_state,
@@ -416,6 +560,17 @@ namespace daw::json {
 
 				using constructor_t = typename JsonMember::constructor_t;
 				if constexpr( KnownBounds ) {
+					if constexpr( ParseState::is_validate_utf8_values ) {
+						ensure_valid_utf8( parse_state, std::data( parse_state ),
+						                   daw::data_end( parse_state ) );
+					}
+					if constexpr( ParseState::is_in_situ_strings ) {
+						char *const last = decode_string_in_situ( parse_state );
+						return construct_value(
+						  template_args<json_result<JsonMember>, constructor_t>,
+						  parse_state, parse_state.first,
+						  static_cast<std::size_t>( last - parse_state.first ) );
+					}
 					return construct_value(
 					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
 					  std::data( parse_state ), std::size( parse_state ) );
@@ -423,6 +578,16 @@ namespace daw::json {
 					if constexpr( JsonMember::allow_escape_character ==
 					              options::AllowEscapeCharacter::Allow ) {
 						auto const str = skip_string( parse_state );
+						if constexpr( ParseState::is_validate_utf8_values ) {
+							ensure_valid_utf8( str, std::data( str ), daw::data_end( str ) );
+						}
+						if constexpr( ParseState::is_in_situ_strings ) {
+							char *const last = decode_string_in_situ( str );
+							return construct_value(
+							  template_args<json_result<JsonMember>, constructor_t>,
+							  parse_state, str.first,
+							  static_cast<std::size_t>( last - str.first ) );
+						}
 						return construct_value(
 						  template_args<json_result<JsonMember>, constructor_t>,
 						  parse_state, std::data( str ), std::size( str ) );
@@ -432,6 +597,9 @@ namespace daw::json {
 						char const *const first = parse_state.first;
 						parse_state.template move_to_next_of<'"'>( );
 						char const *const last = parse_state.first;
+						if constexpr( ParseState::is_validate_utf8_values ) {
+							ensure_valid_utf8( parse_state, first, last );
+						}
 						parse_state.remove_prefix( );
 						return construct_value(
 						  template_args<json_result<JsonMember>, constructor_t>,
@@ -465,6 +633,120 @@ namespace daw::json {
 			inline constexpr bool has_json_member_parse_to_v =
 			  daw::is_detected_v<json_member_constructor_t, T>;
 
+			template<typename T>
+			using json_member_is_arena_string_t = decltype( T::is_arena_string );
+
+			template<typename T>
+			inline constexpr bool is_arena_string_v =
+			  daw::is_detected_v<json_member_is_arena_string_t, T>;
+
+			template<typename T>
+			using json_member_is_interned_string_t =
+			  decltype( T::is_interned_string );
+
+			template<typename T>
+			inline constexpr bool is_interned_string_v =
+			  daw::is_detected_v<json_member_is_interned_string_t, T>;
+
+			/***
+			 * With known bounds the string has not been searched for escapes yet,
+			 * otherwise skip_string noted the first one
+			 */
+			template<bool KnownBounds, typename ParseState>
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr bool
+			string_has_escape( ParseState const &str ) {
+				if constexpr( KnownBounds ) {
+					return find_escape( str, str.first ) != str.last;
+				} else {
+					return needs_slow_path( str );
+				}
+			}
+
+			/***
+			 * json_string_arena.  A string without escapes is a view of the
+			 * document, otherwise it is decoded in place with
+			 * options::InSituStrings or into memory from the parse allocator.  The
+			 * memory is never deallocated by the parser
+			 */
+			template<typename JsonMember, bool KnownBounds, typename ParseState>
+			[[nodiscard]] constexpr json_result<JsonMember>
+			parse_arena_string( ParseState &parse_state ) {
+				static_assert( ParseState::has_allocator or
+				                 ParseState::is_in_situ_strings,
+				               "json_string_arena requires an allocator, see "
+				               "from_json_alloc, or options::InSituStrings" );
+				using constructor_t = typename JsonMember::constructor_t;
+				auto str = KnownBounds ? parse_state : skip_string( parse_state );
+				if constexpr( JsonMember::eight_bit_mode ==
+				              options::EightBitModes::DisallowHigh ) {
+					ensure_no_high_eight( str, std::data( str ), daw::data_end( str ) );
+				}
+				if constexpr( ParseState::is_validate_utf8_values ) {
+					ensure_valid_utf8( str, std::data( str ), daw::data_end( str ) );
+				}
+				if( not string_has_escape<KnownBounds>( str ) ) {
+					return construct_value(
+					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
+					  std::data( str ), std::size( str ) );
+				}
+				char *out = nullptr;
+				if constexpr( ParseState::is_in_situ_strings ) {
+					out = str.first;
+				} else {
+					auto alloc = parse_state.get_allocator_for( template_arg<char> );
+					out = std::allocator_traits<decltype( alloc )>::allocate(
+					  alloc, std::size( str ) );
+				}
+				char *const last = decode_string_to( str, out );
+				return construct_value(
+				  template_args<json_result<JsonMember>, constructor_t>, parse_state,
+				  static_cast<char const *>( out ),
+				  static_cast<std::size_t>( last - out ) );
+			}
+
+			/***
+			 * json_string_interned.  The string is decoded, in place with
+			 * options::InSituStrings, and interned in the table of this thread
+			 */
+			template<typename JsonMember, bool KnownBounds, typename ParseState>
+			[[nodiscard]] json_result<JsonMember>
+			parse_interned_string( ParseState &parse_state ) {
+				using table_t = typename JsonMember::intern_table_t;
+				using constructor_t = typename JsonMember::constructor_t;
+				table_t *const table = current_string_intern_table<table_t>;
+				daw_json_ensure( table != nullptr,
+				                 ErrorReason::MissingStringInternTable, parse_state );
+				auto str = KnownBounds ? parse_state : skip_string( parse_state );
+				if constexpr( JsonMember::eight_bit_mode ==
+				              options::EightBitModes::DisallowHigh ) {
+					ensure_no_high_eight( str, std::data( str ), daw::data_end( str ) );
+				}
+				if constexpr( ParseState::is_validate_utf8_values ) {
+					ensure_valid_utf8( str, std::data( str ), daw::data_end( str ) );
+				}
+				auto const value = [&] {
+					if( not string_has_escape<KnownBounds>( str ) ) {
+						return table->intern(
+						  std::string_view( std::data( str ), std::size( str ) ) );
+					}
+					if constexpr( ParseState::is_in_situ_strings ) {
+						char *const last = decode_string_in_situ( str );
+						return table->intern( std::string_view(
+						  str.first, static_cast<std::size_t>( last - str.first ) ) );
+					} else {
+						// Only escaped strings need a buffer for the decoded text
+						auto buffer = std::string( std::size( str ), '\0' );
+						char *const last = decode_string_to( str, std::data( buffer ) );
+						return table->intern( std::string_view(
+						  std::data( buffer ),
+						  static_cast<std::size_t>( last - std::data( buffer ) ) ) );
+					}
+				}( );
+				return construct_value(
+				  template_args<json_result<JsonMember>, constructor_t>, parse_state,
+				  std::data( value ), std::size( value ) );
+			}
+
 			template<typename JsonMember, bool KnownBounds, typename ParseState>
 			[[nodiscard]] constexpr json_result<JsonMember>
 			parse_value( ParseState &parse_state,
@@ -473,7 +755,11 @@ namespace daw::json {
 				static_assert( has_json_member_parse_to_v<JsonMember> );
 
 				using constructor_t = typename JsonMember::constructor_t;
-				if constexpr( can_parse_to_stdstring_fast_v<JsonMember> ) {
+				if constexpr( is_arena_string_v<JsonMember> ) {
+					return parse_arena_string<JsonMember, KnownBounds>( parse_state );
+				} else if constexpr( is_interned_string_v<JsonMember> ) {
+					return parse_interned_string<JsonMember, KnownBounds>( parse_state );
+				} else if constexpr( can_parse_to_stdstring_fast_v<JsonMember> ) {
 					using AllowHighEightbits =
 					  std::bool_constant<JsonMember::eight_bit_mode !=
 					                     options::EightBitModes::DisallowHigh>;
@@ -489,6 +775,10 @@ namespace daw::json {
 					}
 					// There are no escapes in the string, we can just use the ptr/size
 					// ctor
+					if constexpr( ParseState::is_validate_utf8_values ) {
+						ensure_valid_utf8( parse_state2, std::data( parse_state2 ),
+						                   daw::data_end( parse_state2 ) );
+					}
 					return construct_value(
 					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
 					  std::data( parse_state2 ), daw::data_end( parse_state2 ) );
@@ -507,6 +797,10 @@ namespace daw::json {
 					}
 					// There are no escapes in the string, we can just use the ptr/size
 					// ctor
+					if constexpr( ParseState::is_validate_utf8_values ) {
+						ensure_valid_utf8( parse_state2, std::data( parse_state2 ),
+						                   daw::data_end( parse_state2 ) );
+					}
 					return construct_value(
 					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
 					  std::data( parse_state2 ), daw::data_end( parse_state2 ) );
@@ -718,6 +1012,13 @@ namespace daw::json {
 				                      ErrorReason::InvalidArrayStart, parse_state );
 				parse_state.remove_prefix( );
 				parse_state.trim_left_unchecked( );
+				if constexpr( is_number_array_v<JsonMember> ) {
+					if( auto const count = number_array_size( parse_state );
+					    count >= 0 ) {
+						return parse_number_array<JsonMember, KnownBounds>(
+						  parse_state, static_cast<std::size_t>( count ) );
+					}
+				}
 				// TODO: add parse option to disable random access iterators. This is
 				// coding to the implementations
 
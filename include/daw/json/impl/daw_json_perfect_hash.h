@@ -0,0 +1,191 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_uint_buffer.h>
+
+#include <array>
+#include <ciso646>
+#include <cstddef>
+#include <cstdint>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief Below this many members the linear probe from the expected
+			/// position is faster than a perfect hash lookup, as most documents are
+			/// in the same order as the mapping
+			inline constexpr std::size_t perfect_hash_min_members = 8;
+
+			DAW_ATTRIB_INLINE constexpr std::uint32_t
+			perfect_hash_mix( std::uint32_t h, std::uint32_t seed ) {
+				h ^= seed;
+				h *= 0x9E37'79B1U;
+				h ^= h >> 15U;
+				h *= 0x85EB'CA77U;
+				h ^= h >> 13U;
+				return h;
+			}
+
+			/***
+			 * A perfect hash of N distinct member name hashes, built at compile
+			 * time with hash and displace.  Each hash belongs to a bucket, and each
+			 * bucket has a pilot that moves all of its hashes to free slots.  A
+			 * lookup is two mixes, an xor and one load.  The slot holds the member
+			 * index, the caller must still compare the hash and, when needed, the
+			 * name as an unknown name can land on any slot
+			 */
+			template<std::size_t N>
+			struct perfect_hash_table {
+				// Room for up to 4 times the members if the first sizes fail
+				static constexpr std::size_t max_capacity = [] {
+					std::size_t result = 2;
+					while( result < N ) {
+						result *= 2U;
+					}
+					return result * 4U;
+				}( );
+				static constexpr std::uint16_t empty_slot = 0xFFFFU;
+				static_assert( N < empty_slot, "Too many members for perfect hash" );
+
+				bool is_valid = false;
+				// The buckets and slots have the same count, a power of 2
+				std::uint32_t bucket_shift = 32;
+				std::array<std::uint32_t, max_capacity> pilots{ };
+				std::array<std::uint16_t, max_capacity> slots{ };
+
+				[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::size_t
+				bucket( std::uint32_t h ) const {
+					return static_cast<std::size_t>( perfect_hash_mix( h, 0U ) >>
+					                                 bucket_shift );
+				}
+
+				[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::size_t
+				slot( std::uint32_t h, std::uint32_t pilot ) const {
+					// The multiply moves every bit of the pilot into the top bits
+					return static_cast<std::size_t>(
+					  ( ( perfect_hash_mix( h, 0x5BD1'E995U ) ^ pilot ) * 0x9E37'79B1U ) >>
+					  bucket_shift );
+				}
+
+				/// @return The index of the member that hash could be, or a value
+				/// that is not less than N
+				[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::size_t
+				find( UInt32 hash ) const {
+					auto const h = static_cast<std::uint32_t>( hash );
+					return slots[slot( h, pilots[bucket( h )] )];
+				}
+			};
+
+			template<std::size_t N>
+			constexpr bool
+			try_make_perfect_hash( perfect_hash_table<N> &table,
+			                       std::array<std::uint32_t, N> const &hashes,
+			                       std::size_t capacity, std::uint32_t bits ) {
+				constexpr std::uint32_t max_pilot_attempts = 4096U;
+				table.bucket_shift = 32U - bits;
+				for( auto &s : table.slots ) {
+					s = perfect_hash_table<N>::empty_slot;
+				}
+				for( auto &p : table.pilots ) {
+					p = 0;
+				}
+				std::array<std::size_t, perfect_hash_table<N>::max_capacity>
+				  bucket_sizes{ };
+				for( std::size_t n = 0; n < N; ++n ) {
+					++bucket_sizes[table.bucket( hashes[n] )];
+				}
+				std::size_t largest = 0;
+				for( std::size_t b = 0; b < capacity; ++b ) {
+					if( bucket_sizes[b] > largest ) {
+						largest = bucket_sizes[b];
+					}
+				}
+				// Place the largest buckets first while the table is empty
+				for( std::size_t size = largest; size > 0; --size ) {
+					for( std::size_t b = 0; b < capacity; ++b ) {
+						if( bucket_sizes[b] != size ) {
+							continue;
+						}
+						bool placed = false;
+						for( std::uint32_t attempt = 0;
+						     not placed and attempt < max_pilot_attempts; ++attempt ) {
+							std::uint32_t const pilot = perfect_hash_mix( attempt, 0U );
+							std::array<std::size_t, perfect_hash_table<N>::max_capacity>
+							  taken{ };
+							std::size_t taken_count = 0;
+							placed = true;
+							for( std::size_t n = 0; placed and n < N; ++n ) {
+								if( table.bucket( hashes[n] ) != b ) {
+									continue;
+								}
+								std::size_t const s = table.slot( hashes[n], pilot );
+								if( table.slots[s] != perfect_hash_table<N>::empty_slot ) {
+									placed = false;
+									break;
+								}
+								for( std::size_t t = 0; t < taken_count; ++t ) {
+									if( taken[t] == s ) {
+										placed = false;
+										break;
+									}
+								}
+								taken[taken_count++] = s;
+							}
+							if( placed ) {
+								table.pilots[b] = pilot;
+								for( std::size_t n = 0; n < N; ++n ) {
+									if( table.bucket( hashes[n] ) == b ) {
+										table.slots[table.slot( hashes[n], pilot )] =
+										  static_cast<std::uint16_t>( n );
+									}
+								}
+							}
+						}
+						if( not placed ) {
+							return false;
+						}
+					}
+				}
+				return true;
+			}
+
+			/// @brief Build a perfect hash of the member name hashes.  is_valid is
+			/// false when the hashes are not distinct or no table was found
+			template<std::size_t N>
+			constexpr perfect_hash_table<N>
+			make_perfect_hash( std::array<std::uint32_t, N> const &hashes ) {
+				auto result = perfect_hash_table<N>{ };
+				for( std::size_t n = 0; n < N; ++n ) {
+					for( std::size_t m = n + 1U; m < N; ++m ) {
+						if( hashes[n] == hashes[m] ) {
+							return result;
+						}
+					}
+				}
+				std::size_t capacity = perfect_hash_table<N>::max_capacity / 4U;
+				std::uint32_t bits = 0;
+				while( ( std::size_t{ 1 } << bits ) < capacity ) {
+					++bits;
+				}
+				for( ; capacity <= perfect_hash_table<N>::max_capacity;
+				     capacity *= 2U, ++bits ) {
+					if( try_make_perfect_hash( result, hashes, capacity, bits ) ) {
+						result.is_valid = true;
+						return result;
+					}
+				}
+				return result;
+			}
+		} // namespace json_details
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -136,11 +136,13 @@ namespace daw::json {
 				if constexpr( sizeof...( Is ) > 0 ) {
 					if constexpr( it.output_trailing_comma ==
 					              options::OutputTrailingComma::Yes ) {
-						it.put( ',' );
+						it.write_next_member( ",", "}" );
+					} else {
+						it.write_next_member( "", "}" );
 					}
-					it.next_member( );
+				} else {
+					it.put( '}' );
 				}
-				it.put( '}' );
 				return it;
 			}
 
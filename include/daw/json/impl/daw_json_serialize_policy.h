@@ -17,10 +17,12 @@
 #include "daw_json_serialize_policy_details.h"
 
 #include <daw/daw_move.h>
+#include <daw/daw_string_view.h>
 
 #include <cstddef>
 #include <iterator>
 #include <memory>
+#include <string_view>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
@@ -96,13 +98,33 @@ namespace daw::json {
 				--indentation_level;
 			}
 
+			static constexpr std::string_view indent =
+			  json_details::serialization::generate_indent<serialization_format,
+			                                               indentation_type>;
+
+			/***
+			 * The indentation of the current level when it is at most
+			 * indent_run_levels deep
+			 */
+			constexpr daw::string_view current_indent( ) const {
+				constexpr auto const &indent_run =
+				  json_details::serialization::generate_indent_run<
+				    serialization_format, indentation_type>;
+				return daw::string_view( std::data( indent_run ),
+				                         indentation_level * indent.size( ) );
+			}
+
 			inline constexpr void output_indent( ) {
-				constexpr std::string_view indent =
-				  json_details::serialization::generate_indent<serialization_format,
-				                                               indentation_type>;
-				if( not indent.empty( ) ) {
-					for( std::size_t n = 0; n < indentation_level; ++n ) {
-						write( indent );
+				if constexpr( not indent.empty( ) ) {
+					if( indentation_level <=
+					    json_details::serialization::indent_run_levels ) {
+						if( indentation_level > 0 ) {
+							write( current_indent( ) );
+						}
+					} else {
+						for( std::size_t n = 0; n < indentation_level; ++n ) {
+							write( indent );
+						}
 					}
 				}
 			}
@@ -128,6 +150,54 @@ namespace daw::json {
 				output_indent( );
 			}
 
+			static constexpr daw::string_view newline =
+			  serialization_format == options::SerializationFormat::Minified ? nullptr
+			  : newline_delimiter == options::NewLineDelimiter::n            ? "\n"
+			                                                                 : "\r\n";
+
+			/***
+			 * Write before, the newline and indentation of the next member, and
+			 * after, with one write when the indentation is at most
+			 * indent_run_levels deep
+			 */
+			constexpr void write_next_member( daw::string_view before,
+			                                  daw::string_view after ) {
+				if constexpr( serialization_format ==
+				              options::SerializationFormat::Minified ) {
+					write( before, after );
+				} else {
+					if( indentation_level <=
+					    json_details::serialization::indent_run_levels ) {
+						write( before, newline, current_indent( ), after );
+					} else {
+						write( before, newline );
+						output_indent( );
+						write( after );
+					}
+				}
+			}
+
+			/***
+			 * Write the precomputed separator and name of a class member, e.g.
+			 * ,"name":, followed by a space when not minified.  The comma is not
+			 * written for the first member, and the newline and indentation are
+			 * written after it.  When minified it is written as is
+			 */
+			constexpr void write_member_name( daw::string_view comma_name,
+			                                  bool is_first ) {
+				auto const name =
+				  daw::string_view( std::data( comma_name ) + 1,
+				                    std::size( comma_name ) - 1 );
+				if constexpr( serialization_format ==
+				              options::SerializationFormat::Minified ) {
+					write( is_first ? name : comma_name );
+				} else {
+					write_next_member(
+					  daw::string_view( std::data( comma_name ), is_first ? 0U : 1U ),
+					  name );
+				}
+			}
+
 			template<typename... ContiguousCharRanges>
 			constexpr void write( ContiguousCharRanges &&...chrs ) {
 				static_assert( sizeof...( ContiguousCharRanges ) > 0 );
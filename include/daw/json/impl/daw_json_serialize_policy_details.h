@@ -14,8 +14,10 @@
 #include "daw_json_parse_options_impl.h"
 #include "daw_json_serialize_options_impl.h"
 
+#include <array>
 #include <cstddef>
 #include <iterator>
+#include <string_view>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
@@ -289,6 +291,27 @@ namespace daw::json {
 			inline constexpr std::string_view
 			  generate_indent<options::SerializationFormat::Pretty,
 			                  options::IndentationType::Space10> = "          ";
+
+			/// The number of indentation levels that are written with one write
+			inline constexpr std::size_t indent_run_levels = 16;
+
+			/***
+			 * indent_run_levels copies of the indentation, so that the
+			 * indentation of a level is a prefix of it
+			 */
+			template<options::SerializationFormat Format,
+			         options::IndentationType Indentation>
+			inline constexpr auto generate_indent_run = [] {
+				constexpr std::string_view indent =
+				  generate_indent<Format, Indentation>;
+				std::array<char, indent_run_levels * indent.size( )> result{ };
+				if constexpr( not indent.empty( ) ) {
+					for( std::size_t n = 0; n < result.size( ); ++n ) {
+						result[n] = indent[n % indent.size( )];
+					}
+				}
+				return result;
+			}( );
 		} // namespace json_details::serialization
 	}   // namespace DAW_JSON_VER
 } // namespace daw::json
@@ -16,6 +16,7 @@
 #include "daw_json_parse_digit.h"
 #include "daw_json_parse_policy_policy_details.h"
 #include "daw_json_parse_string_quote.h"
+#include "daw_json_structural_index.h"
 
 #include <daw/daw_attributes.h>
 #include <daw/daw_bit_cast.h>
@@ -38,6 +39,14 @@ namespace daw::json {
 			template<typename ParseState>
 			[[nodiscard]] DAW_ATTRIB_FLATINLINE inline constexpr ParseState
 			skip_string_nq( ParseState &parse_state ) {
+				if constexpr( ParseState::has_structural_index and
+				              not ParseState::exclude_special_escapes( ) ) {
+					// The index does not validate the characters in the string
+					auto result = ParseState( );
+					if( skip_string_nq_indexed( parse_state, result ) ) {
+						return result;
+					}
+				}
 				auto result = parse_state;
 				result.counter =
 				  string_quote::string_quote_parser::parse_nq( parse_state );
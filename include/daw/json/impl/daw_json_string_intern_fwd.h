@@ -0,0 +1,27 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief See daw_json_string_intern.h.  It must be included to parse
+		/// json_string_interned members
+		class string_intern_table;
+		class concurrent_string_intern_table;
+
+		namespace json_details {
+			/// @brief The table used by json_string_interned members of the
+			/// current thread, see string_intern_scope
+			template<typename Table>
+			inline thread_local Table *current_string_intern_table = nullptr;
+		} // namespace json_details
+	}   // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,619 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "daw_json_cpu_dispatch.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_likely.h>
+
+#include <ciso646>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+/// A stage 1 pass, in the style of simdjson, that records the offset of every
+/// structural character(`{}[]:,` outside of strings and the unescaped quotes)
+/// in the document.  A second pass links each opening bracket and quote to
+/// its closing partner so that skipping a value becomes a lookup instead of a
+/// rescan of the bytes.  See options::StructuralIndex
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// Bit n of the result is the xor of bits 0 through n of the input.  For
+			/// a mask of quote positions this gives the characters inside strings,
+			/// including the opening quote and excluding the closing quote
+			DAW_ATTRIB_INLINE constexpr std::uint32_t
+			prefix_xor( std::uint32_t bitmask ) {
+				bitmask ^= bitmask << 1U;
+				bitmask ^= bitmask << 2U;
+				bitmask ^= bitmask << 4U;
+				bitmask ^= bitmask << 8U;
+				bitmask ^= bitmask << 16U;
+				return bitmask;
+			}
+
+			class structural_index {
+			public:
+				static constexpr std::size_t npos = static_cast<std::size_t>( -1 );
+				static constexpr std::size_t block_size = 32;
+
+				/// The meaning of value depends on the character at position.  For `{`,
+				/// `[`, and an opening quote it is the index of the closing entry.  For
+				/// `}` and `]` it is the count of commas directly inside the
+				/// container, matching the counter from skip_class/skip_array.  For a
+				/// closing quote it is the offset of the first escape from the start of
+				/// the string or npos, matching the counter from skip_string
+				struct entry {
+					std::size_t position;
+					std::size_t value;
+				};
+
+			private:
+				char const *m_first = nullptr;
+				char const *m_last = nullptr;
+				std::vector<entry> m_entries{ };
+				bool m_is_valid = false;
+
+				struct block_masks {
+					std::uint32_t backslashes;
+					std::uint32_t quotes;
+					std::uint32_t operators;
+				};
+
+				static block_masks classify_scalar( char const *block ) {
+					auto result = block_masks{ 0, 0, 0 };
+					for( std::size_t n = 0; n < block_size; ++n ) {
+						auto const bit = 1U << n;
+						switch( block[n] ) {
+						case '\\':
+							result.backslashes |= bit;
+							break;
+						case '"':
+							result.quotes |= bit;
+							break;
+						case '{':
+						case '}':
+						case '[':
+						case ']':
+						case ':':
+						case ',':
+							result.operators |= bit;
+							break;
+						}
+					}
+					return result;
+				}
+
+#if defined( DAW_JSON_HAS_CPU_DISPATCH )
+				DAW_ATTRIB_INLINE static std::uint32_t eq_mask16( __m128i block,
+				                                                  char c ) {
+					return static_cast<std::uint32_t>( _mm_movemask_epi8(
+					  _mm_cmpeq_epi8( block, _mm_set1_epi8( c ) ) ) );
+				}
+
+				DAW_ATTRIB_INLINE static std::uint32_t ops_mask16( __m128i block ) {
+					__m128i const m =
+					  _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( block,
+					                                               _mm_set1_epi8( '{' ) ),
+					                              _mm_cmpeq_epi8( block,
+					                                              _mm_set1_epi8( '}' ) ) ),
+					                _mm_or_si128( _mm_cmpeq_epi8( block,
+					                                              _mm_set1_epi8( '[' ) ),
+					                              _mm_cmpeq_epi8( block,
+					                                              _mm_set1_epi8( ']' ) ) ) );
+					__m128i const sep =
+					  _mm_or_si128( _mm_cmpeq_epi8( block, _mm_set1_epi8( ':' ) ),
+					                _mm_cmpeq_epi8( block, _mm_set1_epi8( ',' ) ) );
+					return static_cast<std::uint32_t>(
+					  _mm_movemask_epi8( _mm_or_si128( m, sep ) ) );
+				}
+
+				static block_masks classify( char const *block ) {
+					__m128i const lo =
+					  _mm_loadu_si128( reinterpret_cast<__m128i const *>( block ) );
+					__m128i const hi =
+					  _mm_loadu_si128( reinterpret_cast<__m128i const *>( block + 16 ) );
+					return { eq_mask16( lo, '\\' ) | ( eq_mask16( hi, '\\' ) << 16U ),
+					         eq_mask16( lo, '"' ) | ( eq_mask16( hi, '"' ) << 16U ),
+					         ops_mask16( lo ) | ( ops_mask16( hi ) << 16U ) };
+				}
+#else
+				static block_masks classify( char const *block ) {
+					return classify_scalar( block );
+				}
+#endif
+
+				/// The character at pos is escaped when an odd run of backslashes
+				/// precedes it.  This lets a chunk find its escape carry without
+				/// indexing the previous chunk
+				static std::uint32_t escape_carry( char const *doc, std::size_t pos ) {
+					std::size_t n = 0;
+					while( n < pos and doc[pos - n - 1U] == '\\' ) {
+						++n;
+					}
+					return static_cast<std::uint32_t>( n & 1U );
+				}
+
+				template<typename BlockFunction>
+				static void for_each_block( char const *doc, std::size_t first,
+				                            std::size_t last, BlockFunction &&func ) {
+					std::size_t base = first;
+					for( ; last - base >= block_size; base += block_size ) {
+						func( classify( doc + base ), base );
+					}
+					if( base < last ) {
+						// Spaces are never structural
+						char tail[block_size];
+						std::memset( tail, ' ', block_size );
+						std::memcpy( tail, doc + base, last - base );
+						func( classify_scalar( tail ), base );
+					}
+				}
+
+			public:
+				/// A piece of the document for stage 1.  Chunks can be indexed on
+				/// separate threads, see daw_json_parallel.h.  Their boundaries are on
+				/// multiples of block_size so only the last one has a partial block
+				struct chunk {
+					std::size_t first = 0;
+					std::size_t last = 0;
+					bool starts_in_string = false;
+					bool ends_in_string = false;
+					std::vector<entry> entries{ };
+					std::vector<std::size_t> escapes{ };
+				};
+
+				/// Split a document of size characters into at most count chunks
+				[[nodiscard]] static std::vector<chunk> make_chunks( std::size_t size,
+				                                                     std::size_t count ) {
+					std::size_t const blocks = ( size + block_size - 1U ) / block_size;
+					if( count == 0 ) {
+						count = 1;
+					}
+					std::size_t const blocks_per_chunk =
+					  blocks > count ? ( blocks + count - 1U ) / count : 1U;
+					auto result = std::vector<chunk>( );
+					result.reserve( count );
+					for( std::size_t b = 0; b < blocks; b += blocks_per_chunk ) {
+						auto &c = result.emplace_back( );
+						c.first = b * block_size;
+						c.last = ( b + blocks_per_chunk ) * block_size;
+						if( c.last > size ) {
+							c.last = size;
+						}
+					}
+					return result;
+				}
+
+				/// Is there an odd number of unescaped quotes in the chunk.  The parity
+				/// of the chunks before a chunk says if it starts inside of a string
+				[[nodiscard]] static bool chunk_quote_parity( char const *doc,
+				                                              chunk const &c ) {
+					std::uint32_t prev_escaped = escape_carry( doc, c.first );
+					std::uint32_t parity = 0;
+					for_each_block( doc, c.first, c.last,
+					                [&]( block_masks const &m, std::size_t ) {
+						                std::uint32_t const escaped =
+						                  cpu_dispatch::find_escaped<block_size>(
+						                    prev_escaped, m.backslashes );
+						                // The top bit of the prefix xor is the parity
+						                parity ^= prefix_xor( m.quotes & ~escaped ) >> 31U;
+					                } );
+					return parity != 0;
+				}
+
+				/// Stage 1.  Find the structural characters of each 32 byte block of
+				/// the chunk and append their offsets.  The positions of escapes
+				/// inside strings are collected too so that stage 2 can fill in the
+				/// skip_string counter.  starts_in_string must be set already
+				static void index_chunk( char const *doc, chunk &c ) {
+					std::uint32_t prev_escaped = escape_carry( doc, c.first );
+					std::uint32_t prev_in_string = c.starts_in_string ? ~0U : 0U;
+					c.entries.clear( );
+					c.escapes.clear( );
+					// Most JSON has a structural character every 4-8 bytes
+					c.entries.reserve( ( c.last - c.first ) / 4U );
+
+					for_each_block( doc, c.first, c.last, [&]( block_masks const &m,
+					                                           std::size_t base ) {
+						std::uint32_t const escaped =
+						  cpu_dispatch::find_escaped<block_size>( prev_escaped,
+						                                          m.backslashes );
+						std::uint32_t const quotes = m.quotes & ~escaped;
+						std::uint32_t const in_string =
+						  prefix_xor( quotes ) ^ prev_in_string;
+						prev_in_string = 0U - ( in_string >> 31U );
+
+						std::uint32_t escapes_in_string = escaped & in_string;
+						while( DAW_UNLIKELY( escapes_in_string != 0 ) ) {
+							// The escape starts at the backslash before the escaped character
+							c.escapes.push_back(
+							  base +
+							  static_cast<std::size_t>(
+							    cpu_dispatch::lsb_index( escapes_in_string ) ) -
+							  1U );
+							escapes_in_string &= escapes_in_string - 1U;
+						}
+						std::uint32_t structurals = ( m.operators & ~in_string ) | quotes;
+						while( structurals != 0 ) {
+							c.entries.push_back(
+							  entry{ base + static_cast<std::size_t>(
+							                  cpu_dispatch::lsb_index( structurals ) ),
+							         0 } );
+							structurals &= structurals - 1U;
+						}
+					} );
+					c.ends_in_string = prev_in_string != 0;
+				}
+
+			private:
+				/// Stage 2.  Link the brackets and quotes with their partners.  Inside
+				/// of strings nothing is structural, so the closing quote is always the
+				/// next entry after the opening quote
+				void link_structurals( std::vector<std::size_t> const &escapes ) {
+					struct open_container {
+						std::size_t index;
+						std::size_t commas;
+					};
+					auto stack = std::vector<open_container>( );
+					std::size_t next_escape = 0;
+					std::size_t const count = m_entries.size( );
+					for( std::size_t n = 0; n < count; ++n ) {
+						switch( m_first[m_entries[n].position] ) {
+						case '{':
+						case '[':
+							stack.push_back( open_container{ n, 0 } );
+							break;
+						case '}':
+						case ']': {
+							if( stack.empty( ) ) {
+								m_is_valid = false;
+								return;
+							}
+							auto const open = stack.back( );
+							stack.pop_back( );
+							char const open_char = m_first[m_entries[open.index].position];
+							char const close_char = m_first[m_entries[n].position];
+							if( ( open_char == '{' ) != ( close_char == '}' ) ) {
+								m_is_valid = false;
+								return;
+							}
+							m_entries[open.index].value = n;
+							m_entries[n].value = open.commas;
+							break;
+						}
+						case ',':
+							if( not stack.empty( ) ) {
+								++stack.back( ).commas;
+							}
+							break;
+						case '"': {
+							// stage 1 guarantees that the strings are terminated
+							std::size_t const str_first = m_entries[n].position + 1U;
+							std::size_t const str_last = m_entries[n + 1U].position;
+							while( next_escape < escapes.size( ) and
+							       escapes[next_escape] < str_first ) {
+								++next_escape;
+							}
+							m_entries[n].value = n + 1U;
+							if( next_escape < escapes.size( ) and
+							    escapes[next_escape] < str_last ) {
+								m_entries[n + 1U].value = escapes[next_escape] - str_first;
+							} else {
+								m_entries[n + 1U].value = npos;
+							}
+							++n;
+							break;
+						}
+						}
+					}
+					m_is_valid = stack.empty( );
+				}
+
+				[[nodiscard]] static std::vector<chunk> index_whole( char const *first,
+				                                                     char const *last ) {
+					if( first == nullptr or last <= first ) {
+						return { };
+					}
+					auto result =
+					  make_chunks( static_cast<std::size_t>( last - first ), 1 );
+					index_chunk( first, result.front( ) );
+					return result;
+				}
+
+			public:
+				structural_index( ) = default;
+
+				/// Index the document [first, last).  If the structure is not
+				/// balanced the index is marked invalid and is not used, the normal
+				/// parser will then report the error
+				structural_index( char const *first, char const *last )
+				  : structural_index( first, last, index_whole( first, last ) ) {}
+
+				/// Finish an index from the chunks of [first, last) after stage 1,
+				/// the chunks must be in document order
+				structural_index( char const *first, char const *last,
+				                  std::vector<chunk> &&chunks )
+				  : m_first( first )
+				  , m_last( last ) {
+					if( chunks.empty( ) ) {
+						return;
+					}
+					// An unterminated string leaves us inside of it
+					m_is_valid = not chunks.back( ).ends_in_string;
+					for( std::size_t n = 1; n < chunks.size( ); ++n ) {
+						m_is_valid = m_is_valid and chunks[n - 1U].ends_in_string ==
+						                              chunks[n].starts_in_string;
+					}
+					if( not m_is_valid ) {
+						return;
+					}
+					if( chunks.size( ) == 1 ) {
+						m_entries = std::move( chunks.front( ).entries );
+						link_structurals( chunks.front( ).escapes );
+						return;
+					}
+					std::size_t entry_count = 0;
+					std::size_t escape_count = 0;
+					for( auto const &c : chunks ) {
+						entry_count += c.entries.size( );
+						escape_count += c.escapes.size( );
+					}
+					auto escapes = std::vector<std::size_t>( );
+					m_entries.reserve( entry_count );
+					escapes.reserve( escape_count );
+					for( auto &c : chunks ) {
+						m_entries.insert( m_entries.end( ), c.entries.begin( ),
+						                  c.entries.end( ) );
+						escapes.insert( escapes.end( ), c.escapes.begin( ),
+						                c.escapes.end( ) );
+						c.entries = std::vector<entry>( );
+					}
+					link_structurals( escapes );
+				}
+
+				[[nodiscard]] bool is_valid( ) const {
+					return m_is_valid;
+				}
+
+				[[nodiscard]] char const *data( ) const {
+					return m_first;
+				}
+
+				[[nodiscard]] char const *data_end( ) const {
+					return m_last;
+				}
+
+				[[nodiscard]] std::size_t size( ) const {
+					return m_entries.size( );
+				}
+
+				[[nodiscard]] entry const &operator[]( std::size_t idx ) const {
+					return m_entries[idx];
+				}
+
+				[[nodiscard]] char const *pointer_to( std::size_t idx ) const {
+					return m_first + m_entries[idx].position;
+				}
+
+				/// @brief Find the entry for the structural character at ptr.  The
+				/// index is not modified, so it can be shared between threads
+				/// @param cursor A hint, the entry after the previous lookup.  Parsing
+				/// moves forward, so most lookups land close to it
+				/// @return The index of the entry or npos if ptr is not a structural
+				/// character of this document
+				[[nodiscard]] std::size_t find( char const *ptr,
+				                                std::size_t cursor = 0 ) const {
+					if( not m_is_valid or ptr < m_first or ptr >= m_last ) {
+						return npos;
+					}
+					auto const pos = static_cast<std::size_t>( ptr - m_first );
+					std::size_t const count = m_entries.size( );
+					std::size_t lo = 0;
+					std::size_t hi = count;
+					if( cursor < count and m_entries[cursor].position <= pos ) {
+						// Gallop forward from the last lookup
+						lo = cursor;
+						std::size_t step = 1;
+						while( lo + step < count and m_entries[lo + step].position <= pos ) {
+							lo += step;
+							step *= 2U;
+						}
+						hi = lo + step < count ? lo + step : count;
+					} else if( cursor < count ) {
+						hi = cursor;
+					}
+					while( lo < hi ) {
+						std::size_t const mid = lo + ( hi - lo ) / 2U;
+						if( m_entries[mid].position < pos ) {
+							lo = mid + 1U;
+						} else {
+							hi = mid;
+						}
+					}
+					if( lo < count and m_entries[lo].position == pos ) {
+						return lo;
+					}
+					return npos;
+				}
+
+				/// @brief The separators of the array whose opening bracket is entry
+				/// open; the bracket, the commas between the elements, and the closing
+				/// bracket.  Element n is between result[n] and result[n + 1]
+				[[nodiscard]] std::vector<char const *>
+				array_boundaries( std::size_t open ) const {
+					std::size_t const close = m_entries[open].value;
+					auto result = std::vector<char const *>( );
+					result.reserve( m_entries[close].value + 2U );
+					result.push_back( pointer_to( open ) );
+					std::size_t n = open + 1U;
+					while( n < close ) {
+						switch( m_first[m_entries[n].position] ) {
+						case '{':
+						case '[':
+							n = m_entries[n].value + 1U;
+							break;
+						case '"':
+							n += 2U;
+							break;
+						case ',':
+							result.push_back( pointer_to( n ) );
+							++n;
+							break;
+						default:
+							++n;
+							break;
+						}
+					}
+					result.push_back( pointer_to( close ) );
+					return result;
+				}
+			};
+
+			/// Used in place of a structural_index when options::StructuralIndex is
+			/// not enabled
+			struct no_structural_index {};
+
+			/// Storage in the parse policy for the index and the cursor of the
+			/// last lookup.  It is empty unless options::StructuralIndex is enabled
+			template<bool UseIndex>
+			struct StructuralIndexWrapper {
+				static constexpr bool has_structural_index = false;
+
+				[[nodiscard]] constexpr structural_index const *
+				get_structural_index( ) const {
+					return nullptr;
+				}
+
+				[[nodiscard]] constexpr std::size_t structural_cursor( ) const {
+					return 0;
+				}
+
+				constexpr void set_structural_cursor( std::size_t ) {}
+
+				constexpr void set_structural_index( structural_index const * ) {}
+				constexpr void set_structural_index( no_structural_index const & ) {}
+			};
+
+			template<>
+			struct StructuralIndexWrapper<true> {
+				static constexpr bool has_structural_index = true;
+
+			private:
+				structural_index const *m_structural_index = nullptr;
+				// The cursor lives here, not in the index, as an index can be shared
+				// by parse states on many threads
+				std::size_t m_structural_cursor = 0;
+
+			public:
+				[[nodiscard]] constexpr structural_index const *
+				get_structural_index( ) const {
+					return m_structural_index;
+				}
+
+				constexpr void set_structural_index( structural_index const *index ) {
+					m_structural_index = index;
+					m_structural_cursor = 0;
+				}
+
+				void set_structural_index( structural_index const &index ) {
+					set_structural_index( &index );
+				}
+
+				[[nodiscard]] constexpr std::size_t structural_cursor( ) const {
+					return m_structural_cursor;
+				}
+
+				constexpr void set_structural_cursor( std::size_t idx ) {
+					m_structural_cursor = idx;
+				}
+
+				constexpr void set_structural_index( no_structural_index const & ) {}
+			};
+
+			/// Build the index for the document if the ParseState wants one
+			template<typename ParseState>
+			[[nodiscard]] constexpr auto make_structural_index( char const *first,
+			                                                    char const *last ) {
+				if constexpr( ParseState::has_structural_index ) {
+					return structural_index( first, last );
+				} else {
+					(void)first;
+					(void)last;
+					return no_structural_index{ };
+				}
+			}
+
+			/// Skip a `{...}` or `[...]` value through the index.  On success
+			/// parse_state is moved past the closing bracket and result has the same
+			/// range and counter as CommentPolicy::skip_bracketed_item_*.  Returns
+			/// false when the index cannot answer and the caller must scan
+			template<char PrimLeft, typename ParseState>
+			[[nodiscard]] bool skip_bracketed_item_indexed( ParseState &parse_state,
+			                                                ParseState &result ) {
+				structural_index const *index = parse_state.get_structural_index( );
+				if( index == nullptr or parse_state.first >= parse_state.last or
+				    *parse_state.first != PrimLeft ) {
+					return false;
+				}
+				std::size_t const open =
+				  index->find( parse_state.first, parse_state.structural_cursor( ) );
+				if( open == structural_index::npos ) {
+					return false;
+				}
+				std::size_t const close = ( *index )[open].value;
+				auto const offset = index->pointer_to( close ) - parse_state.first;
+				if( offset >= parse_state.last - parse_state.first ) {
+					// The closing bracket is outside of the current range, let the
+					// scanner report it
+					return false;
+				}
+				result = parse_state;
+				result.counter = ( *index )[close].value;
+				parse_state.first += offset + 1;
+				result.last = parse_state.first;
+				parse_state.set_structural_cursor( close + 1U );
+				return true;
+			}
+
+			/// Skip a string through the index.  parse_state.first is just after the
+			/// opening quote, as in skip_string_nq
+			template<typename ParseState>
+			[[nodiscard]] bool skip_string_nq_indexed( ParseState &parse_state,
+			                                           ParseState &result ) {
+				structural_index const *index = parse_state.get_structural_index( );
+				if( index == nullptr ) {
+					return false;
+				}
+				std::size_t const open = index->find(
+				  parse_state.first - 1, parse_state.structural_cursor( ) );
+				if( open == structural_index::npos or
+				    *index->pointer_to( open ) != '"' ) {
+					return false;
+				}
+				std::size_t const close = open + 1U;
+				auto const offset = index->pointer_to( close ) - parse_state.first;
+				if( offset >= parse_state.last - parse_state.first ) {
+					return false;
+				}
+				result = parse_state;
+				result.counter = ( *index )[close].value;
+				result.last = parse_state.first + offset;
+				parse_state.first = result.last + 1;
+				parse_state.set_structural_cursor( close + 1U );
+				return true;
+			}
+		} // namespace json_details
+	}   // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -270,6 +270,14 @@ namespace daw::json {
 			template<typename T>
 			using has_ignore_unknown_members_trait_in_class_map =
 			  typename json_data_contract<T>::ignore_unknown_members;
+
+			template<typename T>
+			using has_expect_ordered_members_trait_in_class_map =
+			  typename json_data_contract<T>::expect_ordered_members;
+
+			template<typename T>
+			using has_learn_member_order_trait_in_class_map =
+			  typename json_data_contract<T>::learn_member_order;
 		} // namespace json_details
 
 		template<typename T>
@@ -289,6 +297,25 @@ namespace daw::json {
 		inline constexpr bool is_exact_class_mapping_v =
 		  daw::is_detected_v<json_details::has_exact_mapping_trait_in_class_map, T>;
 
+		/***
+		 * A trait to specify that the JSON objects of this class have their
+		 * members in the same order as the mapping, as with
+		 * options::ExpectOrderedMembers.  Either specialize this variable or have a
+		 * type in your json_data_contract named expect_ordered_members
+		 */
+		template<typename T>
+		inline constexpr bool is_expect_ordered_members_v = daw::is_detected_v<
+		  json_details::has_expect_ordered_members_trait_in_class_map, T>;
+
+		/***
+		 * A trait to learn the member order of the JSON objects of this class, as
+		 * with options::LearnMemberOrder.  Either specialize this variable or have
+		 * a type in your json_data_contract named learn_member_order
+		 */
+		template<typename T>
+		inline constexpr bool is_learn_member_order_v = daw::is_detected_v<
+		  json_details::has_learn_member_order_trait_in_class_map, T>;
+
 		namespace json_details {
 			template<typename T, typename ParseState>
 			inline constexpr bool all_json_members_must_exist_v =
@@ -296,6 +323,15 @@ namespace daw::json {
 			  ( is_exact_class_mapping_v<T> or
 			    ParseState::use_exact_mappings_by_default );
 
+			template<typename T, typename ParseState>
+			inline constexpr bool expect_ordered_members_v =
+			  is_expect_ordered_members_v<T> or
+			  ParseState::expect_ordered_members( );
+
+			template<typename T, typename ParseState>
+			inline constexpr bool learn_member_order_v =
+			  is_learn_member_order_v<T> or ParseState::learn_member_order( );
+
 			template<typename T>
 			using element_type_t = typename T::element_type;
 
@@ -0,0 +1,380 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "daw_json_exec_modes.h"
+
+#include <daw/daw_attributes.h>
+
+#if defined( DAW_ALLOW_SSE42 )
+#include <emmintrin.h>
+#include <smmintrin.h>
+#include <tmmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+#if defined( DAW_ALLOW_AVX2 )
+#include <immintrin.h>
+#endif
+
+#include <ciso646>
+#include <cstddef>
+#include <cstdint>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			DAW_ATTRIB_INLINE constexpr bool is_utf8_continuation( char c ) {
+				return ( static_cast<unsigned char>( c ) & 0xC0U ) == 0x80U;
+			}
+
+			/***
+			 * Validate the UTF-8 sequence at first, whose lead byte is not ASCII.
+			 * Overlong encodings, surrogates and code points past U+10FFFF are
+			 * invalid
+			 * @return The position after the sequence, or nullptr when it is not
+			 * valid
+			 */
+			template<typename CharT>
+			[[nodiscard]] constexpr CharT *skip_utf8_sequence( CharT *first,
+			                                                   CharT *const last ) {
+				auto const lead = static_cast<unsigned char>( *first );
+				std::ptrdiff_t len = 0;
+				// The valid range of the second byte depends on the lead byte
+				unsigned char second_min = 0x80U;
+				unsigned char second_max = 0xBFU;
+				if( lead >= 0xC2U and lead <= 0xDFU ) {
+					len = 2;
+				} else if( lead >= 0xE0U and lead <= 0xEFU ) {
+					len = 3;
+					if( lead == 0xE0U ) {
+						second_min = 0xA0U;
+					} else if( lead == 0xEDU ) {
+						second_max = 0x9FU;
+					}
+				} else if( lead >= 0xF0U and lead <= 0xF4U ) {
+					len = 4;
+					if( lead == 0xF0U ) {
+						second_min = 0x90U;
+					} else if( lead == 0xF4U ) {
+						second_max = 0x8FU;
+					}
+				} else {
+					return nullptr;
+				}
+				if( last - first < len ) {
+					return nullptr;
+				}
+				auto const second = static_cast<unsigned char>( first[1] );
+				if( second < second_min or second > second_max ) {
+					return nullptr;
+				}
+				for( std::ptrdiff_t n = 2; n < len; ++n ) {
+					if( not is_utf8_continuation( first[n] ) ) {
+						return nullptr;
+					}
+				}
+				return first + len;
+			}
+
+			/***
+			 * Find the first byte of [first, last) that is not part of a valid
+			 * UTF-8 sequence.  Runs of ASCII are skipped 8 bytes at a time
+			 * @return The position of the invalid sequence, or last
+			 */
+			template<typename CharT>
+			[[nodiscard]] constexpr CharT *find_invalid_utf8( CharT *first,
+			                                                  CharT *const last ) {
+				while( first < last ) {
+					while( last - first >= 8 ) {
+						std::uint64_t word = 0;
+						for( std::size_t n = 0; n < 8; ++n ) {
+							word |= static_cast<std::uint64_t>(
+							          static_cast<unsigned char>( first[n] ) )
+							        << ( 8U * n );
+						}
+						if( ( word & 0x8080'8080'8080'8080ULL ) != 0 ) {
+							break;
+						}
+						first += 8;
+					}
+					if( first >= last ) {
+						break;
+					}
+					if( static_cast<unsigned char>( *first ) < 0x80U ) {
+						++first;
+						continue;
+					}
+					CharT *const next = skip_utf8_sequence( first, last );
+					if( next == nullptr ) {
+						return first;
+					}
+					first = next;
+				}
+				return last;
+			}
+
+			/***
+			 * Check that [first, last) is valid UTF-8, a byte at a time
+			 */
+			template<typename CharT>
+			[[nodiscard]] constexpr bool
+			is_valid_utf8( constexpr_exec_tag, CharT *first, CharT *const last ) {
+				return find_invalid_utf8( first, last ) == last;
+			}
+
+			/***
+			 * The start of the UTF-8 sequence that may continue past first, after
+			 * the blocks before first have been checked.  Backs up over at most
+			 * three continuations and their lead byte
+			 */
+			template<typename CharT>
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr CharT *
+			utf8_sequence_start( CharT *const start, CharT *first ) {
+				CharT *const block_last = first;
+				while( first > start and block_last - first < 3 and
+				       is_utf8_continuation( first[-1] ) ) {
+					--first;
+				}
+				if( first > start and
+				    static_cast<unsigned char>( first[-1] ) >= 0xC0U ) {
+					--first;
+				}
+				return first;
+			}
+
+#if defined( DAW_ALLOW_SSE42 )
+			/***
+			 * The lookup tables of the UTF-8 validator from "Validating UTF-8 In
+			 * Less Than One Instruction Per Byte", Keiser and Lemire.  Each byte
+			 * is classified by the high nibble and low nibble of the byte before
+			 * it and its own high nibble.  The three lookups are anded, and a bit
+			 * left set is an error
+			 */
+			namespace utf8_lookup {
+				inline constexpr unsigned char too_short = 1U << 0U;
+				inline constexpr unsigned char too_long = 1U << 1U;
+				inline constexpr unsigned char overlong_3 = 1U << 2U;
+				inline constexpr unsigned char too_large = 1U << 3U;
+				inline constexpr unsigned char surrogate = 1U << 4U;
+				inline constexpr unsigned char overlong_2 = 1U << 5U;
+				inline constexpr unsigned char too_large_1000 = 1U << 6U;
+				inline constexpr unsigned char overlong_4 = 1U << 6U;
+				inline constexpr unsigned char two_conts = 1U << 7U;
+				inline constexpr unsigned char carry = too_short | too_long | two_conts;
+
+				alignas( 16 ) inline constexpr unsigned char byte_1_high[16] = {
+				  // 0___ ASCII
+				  too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+				  too_long,
+				  // 10__ continuation
+				  two_conts, two_conts, two_conts, two_conts,
+				  // 1100 two byte lead
+				  too_short | overlong_2,
+				  // 1101 two byte lead
+				  too_short,
+				  // 1110 three byte lead
+				  too_short | overlong_3 | surrogate,
+				  // 1111 four byte lead
+				  too_short | too_large | too_large_1000 | overlong_4 };
+
+				alignas( 16 ) inline constexpr unsigned char byte_1_low[16] = {
+				  carry | overlong_3 | overlong_2 | overlong_4,
+				  carry | overlong_2,
+				  carry,
+				  carry,
+				  carry | too_large,
+				  carry | too_large | too_large_1000,
+				  carry | too_large | too_large_1000,
+				  carry | too_large | too_large_1000,
+				  carry | too_large | too_large_1000,
+				  carry | too_large | too_large_1000,
+				  carry | too_large | too_large_1000,
+				  carry | too_large | too_large_1000,
+				  carry | too_large | too_large_1000,
+				  carry | too_large | too_large_1000 | surrogate,
+				  carry | too_large | too_large_1000,
+				  carry | too_large | too_large_1000 };
+
+				alignas( 16 ) inline constexpr unsigned char byte_2_high[16] = {
+				  // 0___ ASCII
+				  too_short, too_short, too_short, too_short, too_short, too_short,
+				  too_short, too_short,
+				  // 1000
+				  too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 |
+				    overlong_4,
+				  // 1001
+				  too_long | overlong_2 | two_conts | overlong_3 | too_large,
+				  // 101_
+				  too_long | overlong_2 | two_conts | surrogate | too_large,
+				  too_long | overlong_2 | two_conts | surrogate | too_large,
+				  // 11__ lead
+				  too_short, too_short, too_short, too_short };
+
+				// Subtracted with saturation, only a lead byte in the last three
+				// positions whose sequence is longer than the rest of the block is
+				// left non-zero
+				alignas( 16 ) inline constexpr unsigned char incomplete_max[16] = {
+				  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+				  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF };
+			} // namespace utf8_lookup
+
+			DAW_ATTRIB_INLINE __m128i load_utf8_table( sse42_exec_tag,
+			                                           unsigned char const *table ) {
+				return _mm_load_si128( reinterpret_cast<__m128i const *>( table ) );
+			}
+
+			/***
+			 * The errors in input, given the block before it
+			 */
+			DAW_ATTRIB_INLINE __m128i utf8_block_errors( sse42_exec_tag tag,
+			                                             __m128i input,
+			                                             __m128i prev_input ) {
+				__m128i const low_nibble = _mm_set1_epi8( 0x0F );
+				__m128i const prev1 = _mm_alignr_epi8( input, prev_input, 15 );
+				__m128i const prev2 = _mm_alignr_epi8( input, prev_input, 14 );
+				__m128i const prev3 = _mm_alignr_epi8( input, prev_input, 13 );
+				__m128i const special_cases = _mm_and_si128(
+				  _mm_and_si128(
+				    _mm_shuffle_epi8(
+				      load_utf8_table( tag, utf8_lookup::byte_1_high ),
+				      _mm_and_si128( _mm_srli_epi16( prev1, 4 ), low_nibble ) ),
+				    _mm_shuffle_epi8( load_utf8_table( tag, utf8_lookup::byte_1_low ),
+				                      _mm_and_si128( prev1, low_nibble ) ) ),
+				  _mm_shuffle_epi8(
+				    load_utf8_table( tag, utf8_lookup::byte_2_high ),
+				    _mm_and_si128( _mm_srli_epi16( input, 4 ), low_nibble ) ) );
+				// The third and fourth bytes of a sequence must be continuations
+				// Only a three or four byte lead is left with the high bit set
+				__m128i const is_third = _mm_subs_epu8(
+				  prev2, _mm_set1_epi8( static_cast<char>( 0xE0 - 0x80 ) ) );
+				__m128i const is_fourth = _mm_subs_epu8(
+				  prev3, _mm_set1_epi8( static_cast<char>( 0xF0 - 0x80 ) ) );
+				__m128i const must23 = _mm_or_si128( is_third, is_fourth );
+				__m128i const must23_80 =
+				  _mm_and_si128( must23, _mm_set1_epi8( static_cast<char>( 0x80 ) ) );
+				return _mm_xor_si128( must23_80, special_cases );
+			}
+
+			/***
+			 * Check that [first, last) is valid UTF-8, 16 bytes at a time.  Blocks
+			 * of ASCII only check that the block before did not end in a sequence
+			 */
+			template<typename CharT>
+			[[nodiscard]] inline bool
+			is_valid_utf8( sse42_exec_tag tag, CharT *first, CharT *const last ) {
+				CharT *const start = first;
+				__m128i error = _mm_setzero_si128( );
+				__m128i prev_input = _mm_setzero_si128( );
+				__m128i prev_incomplete = _mm_setzero_si128( );
+				while( last - first >= 16 ) {
+					__m128i const input =
+					  _mm_loadu_si128( reinterpret_cast<__m128i const *>( first ) );
+					if( _mm_movemask_epi8( input ) == 0 ) {
+						error = _mm_or_si128( error, prev_incomplete );
+						prev_incomplete = _mm_setzero_si128( );
+					} else {
+						error = _mm_or_si128( error,
+						                      utf8_block_errors( tag, input, prev_input ) );
+						prev_incomplete = _mm_subs_epu8(
+						  input, load_utf8_table( tag, utf8_lookup::incomplete_max ) );
+					}
+					prev_input = input;
+					first += 16;
+				}
+				if( not _mm_testz_si128( error, error ) ) {
+					return false;
+				}
+				return find_invalid_utf8( utf8_sequence_start( start, first ), last ) ==
+				       last;
+			}
+
+#if defined( DAW_ALLOW_AVX2 )
+			DAW_ATTRIB_INLINE __m256i load_utf8_table( avx2_exec_tag,
+			                                           unsigned char const *table ) {
+				return _mm256_broadcastsi128_si256(
+				  _mm_load_si128( reinterpret_cast<__m128i const *>( table ) ) );
+			}
+
+			/***
+			 * The errors in input, given the block before it.  The lookups are per
+			 * 128bit lane, and the previous bytes are shifted in across the lanes
+			 */
+			DAW_ATTRIB_INLINE __m256i utf8_block_errors( avx2_exec_tag tag,
+			                                             __m256i input,
+			                                             __m256i prev_input ) {
+				__m256i const low_nibble = _mm256_set1_epi8( 0x0F );
+				__m256i const shifted =
+				  _mm256_permute2x128_si256( prev_input, input, 0x21 );
+				__m256i const prev1 = _mm256_alignr_epi8( input, shifted, 15 );
+				__m256i const prev2 = _mm256_alignr_epi8( input, shifted, 14 );
+				__m256i const prev3 = _mm256_alignr_epi8( input, shifted, 13 );
+				__m256i const special_cases = _mm256_and_si256(
+				  _mm256_and_si256(
+				    _mm256_shuffle_epi8(
+				      load_utf8_table( tag, utf8_lookup::byte_1_high ),
+				      _mm256_and_si256( _mm256_srli_epi16( prev1, 4 ), low_nibble ) ),
+				    _mm256_shuffle_epi8(
+				      load_utf8_table( tag, utf8_lookup::byte_1_low ),
+				      _mm256_and_si256( prev1, low_nibble ) ) ),
+				  _mm256_shuffle_epi8(
+				    load_utf8_table( tag, utf8_lookup::byte_2_high ),
+				    _mm256_and_si256( _mm256_srli_epi16( input, 4 ), low_nibble ) ) );
+				__m256i const is_third = _mm256_subs_epu8(
+				  prev2, _mm256_set1_epi8( static_cast<char>( 0xE0 - 0x80 ) ) );
+				__m256i const is_fourth = _mm256_subs_epu8(
+				  prev3, _mm256_set1_epi8( static_cast<char>( 0xF0 - 0x80 ) ) );
+				__m256i const must23 = _mm256_or_si256( is_third, is_fourth );
+				__m256i const must23_80 = _mm256_and_si256(
+				  must23, _mm256_set1_epi8( static_cast<char>( 0x80 ) ) );
+				return _mm256_xor_si256( must23_80, special_cases );
+			}
+
+			/***
+			 * Check that [first, last) is valid UTF-8, 32 bytes at a time
+			 */
+			template<typename CharT>
+			[[nodiscard]] inline bool
+			is_valid_utf8( avx2_exec_tag tag, CharT *first, CharT *const last ) {
+				CharT *const start = first;
+				__m256i const incomplete_max = _mm256_setr_m128i(
+				  _mm_set1_epi8( static_cast<char>( 0xFF ) ),
+				  _mm_load_si128( reinterpret_cast<__m128i const *>(
+				    utf8_lookup::incomplete_max ) ) );
+				__m256i error = _mm256_setzero_si256( );
+				__m256i prev_input = _mm256_setzero_si256( );
+				__m256i prev_incomplete = _mm256_setzero_si256( );
+				while( last - first >= 32 ) {
+					__m256i const input =
+					  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( first ) );
+					if( _mm256_movemask_epi8( input ) == 0 ) {
+						error = _mm256_or_si256( error, prev_incomplete );
+						prev_incomplete = _mm256_setzero_si256( );
+					} else {
+						error = _mm256_or_si256(
+						  error, utf8_block_errors( tag, input, prev_input ) );
+						prev_incomplete = _mm256_subs_epu8( input, incomplete_max );
+					}
+					prev_input = input;
+					first += 32;
+				}
+				if( not _mm256_testz_si256( error, error ) ) {
+					return false;
+				}
+				return is_valid_utf8( sse42_exec_tag{ },
+				                      utf8_sequence_start( start, first ), last );
+			}
+#endif
+#endif
+		} // namespace json_details
+	}   // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,440 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "../daw_json_exception.h"
+#include "daw_json_exec_modes.h"
+#include "daw_json_utf8.h"
+#include "daw_not_const_ex_functions.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_likely.h>
+
+#include <ciso646>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief The result of validate_json.  When the document is not valid,
+		/// reason and position say what was wrong and where
+		struct json_validation_result {
+			bool is_valid = true;
+			ErrorReason reason = ErrorReason::Unknown;
+			std::size_t position = 0;
+
+			explicit constexpr operator bool( ) const {
+				return is_valid;
+			}
+		};
+
+		namespace json_details {
+			/***
+			 * A single pass syntax check of a JSON document, RFC 8259 without
+			 * extensions.  The brackets are matched with an explicit stack, strings
+			 * are checked for termination, escapes and control characters, and
+			 * literals and numbers against their grammar.  With the SIMD exec tags
+			 * the plain characters of strings and runs of whitespace are skipped a
+			 * block at a time.  With CheckUTF8 the bytes of strings must be valid
+			 * UTF-8 and the unicode escapes must form valid surrogate pairs
+			 */
+			template<typename ExecTag, bool CheckUTF8>
+			class json_validator {
+				enum class state { value, member, after_value };
+
+				char const *const m_first;
+				char const *m_ptr;
+				char const *const m_last;
+				std::vector<char> m_stack{ };
+				ErrorReason m_reason = ErrorReason::Unknown;
+				char const *m_error = nullptr;
+
+				static constexpr bool is_simd_exec_tag =
+#if defined( DAW_ALLOW_SSE42 )
+				  std::is_base_of_v<sse42_exec_tag, ExecTag>;
+#else
+				  false;
+#endif
+
+				DAW_ATTRIB_NOINLINE bool fail( ErrorReason reason ) {
+					m_reason = reason;
+					m_error = m_ptr;
+					return false;
+				}
+
+				[[nodiscard]] DAW_ATTRIB_INLINE static constexpr bool
+				is_ws( char c ) {
+					return ( c == ' ' ) | ( c == '\t' ) | ( c == '\n' ) | ( c == '\r' );
+				}
+
+				[[nodiscard]] DAW_ATTRIB_INLINE static constexpr bool
+				is_digit( char c ) {
+					return static_cast<unsigned>( static_cast<unsigned char>( c ) ) -
+					         static_cast<unsigned>( '0' ) <
+					       10U;
+				}
+
+				[[nodiscard]] DAW_ATTRIB_INLINE static constexpr bool
+				is_hex( char c ) {
+					return is_digit( c ) or ( c >= 'a' and c <= 'f' ) or
+					       ( c >= 'A' and c <= 'F' );
+				}
+
+				DAW_ATTRIB_INLINE void skip_ws( ) {
+					if( m_ptr >= m_last or not is_ws( *m_ptr ) ) {
+						return;
+					}
+					++m_ptr;
+#if defined( DAW_ALLOW_SSE42 )
+					if constexpr( is_simd_exec_tag ) {
+						m_ptr = mem_move_to_next_not_of<false, ' ', '\t', '\n', '\r'>(
+						  sse42_exec_tag{ }, m_ptr, m_last );
+						return;
+					}
+#endif
+					while( m_ptr < m_last and is_ws( *m_ptr ) ) {
+						++m_ptr;
+					}
+				}
+
+				[[nodiscard]] DAW_ATTRIB_INLINE char const *
+				move_to_string_special( char const *first ) const {
+#if defined( DAW_ALLOW_SSE42 )
+					if constexpr( is_simd_exec_tag ) {
+						return mem_move_to_string_special<CheckUTF8>( ExecTag{ }, first,
+						                                              m_last );
+					}
+#endif
+					while( first < m_last ) {
+						auto const c = static_cast<unsigned char>( *first );
+						if( ( c == '"' ) | ( c == '\\' ) | ( c < 0x20U ) |
+						    ( CheckUTF8 & ( c >= 0x80U ) ) ) {
+							return first;
+						}
+						++first;
+					}
+					return m_last;
+				}
+
+				/// @brief Read the 4 hex digits of a unicode escape at m_ptr
+				[[nodiscard]] bool hex4( unsigned &cp ) {
+					if( m_last - m_ptr < 4 ) {
+						return fail( ErrorReason::InvalidUTFEscape );
+					}
+					cp = 0;
+					for( int n = 0; n < 4; ++n ) {
+						char const c = m_ptr[n];
+						if( not is_hex( c ) ) {
+							return fail( ErrorReason::InvalidUTFEscape );
+						}
+						unsigned const d =
+						  is_digit( c ) ? static_cast<unsigned>( c - '0' )
+						                : static_cast<unsigned>( ( c | 0x20 ) - 'a' ) + 10U;
+						cp = ( cp << 4U ) | d;
+					}
+					m_ptr += 4;
+					return true;
+				}
+
+				/// @brief m_ptr is after the u of a unicode escape
+				[[nodiscard]] bool utf16_escape( ) {
+					unsigned cp = 0;
+					if( not hex4( cp ) ) {
+						return false;
+					}
+					if constexpr( CheckUTF8 ) {
+						if( cp >= 0xDC00U and cp <= 0xDFFFU ) {
+							return fail( ErrorReason::InvalidUTFCodepoint );
+						}
+						if( cp >= 0xD800U and cp <= 0xDBFFU ) {
+							// A high surrogate must be followed by a low one
+							if( m_last - m_ptr < 2 or m_ptr[0] != '\\' or
+							    m_ptr[1] != 'u' ) {
+								return fail( ErrorReason::InvalidUTFCodepoint );
+							}
+							m_ptr += 2;
+							if( not hex4( cp ) ) {
+								return false;
+							}
+							if( cp < 0xDC00U or cp > 0xDFFFU ) {
+								return fail( ErrorReason::InvalidUTFCodepoint );
+							}
+						}
+					}
+					return true;
+				}
+
+				/// @brief m_ptr is at the opening quote
+				[[nodiscard]] bool string( ) {
+					++m_ptr;
+					while( true ) {
+						m_ptr = move_to_string_special( m_ptr );
+						if( DAW_UNLIKELY( m_ptr >= m_last ) ) {
+							return fail( ErrorReason::UnexpectedEndOfData );
+						}
+						auto const c = static_cast<unsigned char>( *m_ptr );
+						if( c == '"' ) {
+							++m_ptr;
+							return true;
+						}
+						if( c == '\\' ) {
+							++m_ptr;
+							if( m_ptr >= m_last ) {
+								return fail( ErrorReason::UnexpectedEndOfData );
+							}
+							switch( *m_ptr ) {
+							case '"':
+							case '\\':
+							case '/':
+							case 'b':
+							case 'f':
+							case 'n':
+							case 'r':
+							case 't':
+								++m_ptr;
+								break;
+							case 'u':
+								++m_ptr;
+								if( not utf16_escape( ) ) {
+									return false;
+								}
+								break;
+							default:
+								return fail( ErrorReason::InvalidString );
+							}
+						} else if( c < 0x20U ) {
+							return fail( ErrorReason::InvalidString );
+						} else {
+							// Only reached with CheckUTF8
+							char const *const next = skip_utf8_sequence( m_ptr, m_last );
+							if( next == nullptr ) {
+								return fail( ErrorReason::InvalidUTFCodepoint );
+							}
+							m_ptr = next;
+						}
+					}
+				}
+
+				DAW_ATTRIB_INLINE void skip_digits( ) {
+					while( m_ptr < m_last and is_digit( *m_ptr ) ) {
+						++m_ptr;
+					}
+				}
+
+				/// @brief -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+				[[nodiscard]] bool number( ) {
+					if( *m_ptr == '-' ) {
+						++m_ptr;
+						if( m_ptr >= m_last ) {
+							return fail( ErrorReason::InvalidNumber );
+						}
+					}
+					if( *m_ptr == '0' ) {
+						++m_ptr;
+					} else if( is_digit( *m_ptr ) ) {
+						skip_digits( );
+					} else {
+						return fail( ErrorReason::InvalidNumberStart );
+					}
+					if( m_ptr < m_last and *m_ptr == '.' ) {
+						++m_ptr;
+						if( m_ptr >= m_last or not is_digit( *m_ptr ) ) {
+							return fail( ErrorReason::InvalidNumber );
+						}
+						skip_digits( );
+					}
+					if( m_ptr < m_last and ( ( *m_ptr | 0x20 ) == 'e' ) ) {
+						++m_ptr;
+						if( m_ptr < m_last and ( *m_ptr == '+' or *m_ptr == '-' ) ) {
+							++m_ptr;
+						}
+						if( m_ptr >= m_last or not is_digit( *m_ptr ) ) {
+							return fail( ErrorReason::InvalidNumber );
+						}
+						skip_digits( );
+					}
+					return true;
+				}
+
+				template<std::size_t N>
+				[[nodiscard]] bool literal( char const ( &lit )[N],
+				                            ErrorReason reason ) {
+					constexpr auto len = static_cast<std::ptrdiff_t>( N - 1 );
+					if( m_last - m_ptr < len ) {
+						return fail( reason );
+					}
+					for( std::ptrdiff_t n = 0; n < len; ++n ) {
+						if( m_ptr[n] != lit[n] ) {
+							return fail( reason );
+						}
+					}
+					m_ptr += len;
+					return true;
+				}
+
+				/// @brief m_ptr is at the start of a value.  Containers are pushed
+				/// and the next state is returned
+				[[nodiscard]] bool value( state &next ) {
+					next = state::after_value;
+					switch( *m_ptr ) {
+					case '{':
+						++m_ptr;
+						skip_ws( );
+						if( m_ptr < m_last and *m_ptr == '}' ) {
+							++m_ptr;
+							return true;
+						}
+						m_stack.push_back( '}' );
+						next = state::member;
+						return true;
+					case '[':
+						++m_ptr;
+						skip_ws( );
+						if( m_ptr < m_last and *m_ptr == ']' ) {
+							++m_ptr;
+							return true;
+						}
+						m_stack.push_back( ']' );
+						next = state::value;
+						return true;
+					case '"':
+						return string( );
+					case 't':
+						return literal( "true", ErrorReason::InvalidTrue );
+					case 'f':
+						return literal( "false", ErrorReason::InvalidFalse );
+					case 'n':
+						return literal( "null", ErrorReason::InvalidNull );
+					case '-':
+					case '0':
+					case '1':
+					case '2':
+					case '3':
+					case '4':
+					case '5':
+					case '6':
+					case '7':
+					case '8':
+					case '9':
+						return number( );
+					default:
+						return fail( ErrorReason::InvalidStartOfValue );
+					}
+				}
+
+				/// @brief m_ptr is at the name of a member
+				[[nodiscard]] bool member( ) {
+					if( m_ptr >= m_last ) {
+						return fail( ErrorReason::UnexpectedEndOfData );
+					}
+					if( *m_ptr != '"' ) {
+						return fail( *m_ptr == '}' ? ErrorReason::TrailingComma
+						                           : ErrorReason::InvalidMemberName );
+					}
+					if( not string( ) ) {
+						return false;
+					}
+					skip_ws( );
+					if( m_ptr >= m_last or *m_ptr != ':' ) {
+						return fail( ErrorReason::MissingMemberNameOrEndOfClass );
+					}
+					++m_ptr;
+					return true;
+				}
+
+				/// @brief m_ptr is after a value inside of a container
+				[[nodiscard]] bool after_value( state &next ) {
+					if( m_ptr >= m_last ) {
+						return fail( ErrorReason::UnexpectedEndOfData );
+					}
+					char const close = m_stack.back( );
+					if( *m_ptr == ',' ) {
+						++m_ptr;
+						skip_ws( );
+						if( close == '}' ) {
+							next = state::member;
+						} else {
+							if( m_ptr < m_last and *m_ptr == ']' ) {
+								return fail( ErrorReason::TrailingComma );
+							}
+							next = state::value;
+						}
+						return true;
+					}
+					if( *m_ptr != close ) {
+						return fail( ErrorReason::InvalidBracketing );
+					}
+					++m_ptr;
+					m_stack.pop_back( );
+					next = state::after_value;
+					return true;
+				}
+
+			public:
+				json_validator( char const *first, char const *last )
+				  : m_first( first )
+				  , m_ptr( first )
+				  , m_last( last ) {}
+
+				[[nodiscard]] json_validation_result validate( ) {
+					skip_ws( );
+					if( m_ptr >= m_last ) {
+						(void)fail( ErrorReason::EmptyJSONDocument );
+						return result( );
+					}
+					auto st = state::value;
+					do {
+						bool good = true;
+						switch( st ) {
+						case state::value:
+							if( m_ptr >= m_last ) {
+								good = fail( ErrorReason::UnexpectedEndOfData );
+							} else {
+								good = value( st );
+							}
+							break;
+						case state::member:
+							good = member( );
+							st = state::value;
+							break;
+						case state::after_value:
+							good = after_value( st );
+							break;
+						}
+						if( not good ) {
+							return result( );
+						}
+						skip_ws( );
+					} while( not( m_stack.empty( ) and st == state::after_value ) );
+					if( m_ptr != m_last ) {
+						(void)fail( ErrorReason::InvalidEndOfValue );
+					}
+					return result( );
+				}
+
+				[[nodiscard]] json_validation_result result( ) const {
+					if( m_error == nullptr ) {
+						return json_validation_result{ };
+					}
+					return json_validation_result{
+					  false, m_reason, static_cast<std::size_t>( m_error - m_first ) };
+				}
+			};
+
+			template<typename ExecTag, bool CheckUTF8>
+			[[nodiscard]] json_validation_result
+			validate_json_impl( char const *first, char const *last ) {
+				return json_validator<ExecTag, CheckUTF8>( first, last ).validate( );
+			}
+		} // namespace json_details
+	}   // namespace DAW_JSON_VER
+} // namespace daw::json
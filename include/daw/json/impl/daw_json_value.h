@@ -345,6 +345,12 @@ namespace daw::json {
 		template<json_options_t PolicyFlags, typename Allocator>
 		struct basic_json_value {
 			using ParseState = BasicParsePolicy<PolicyFlags, Allocator>;
+			/// Decoding a string in place writes an unescaped quote into the
+			/// buffer, a later scan of the value would end the string there
+			static_assert(
+			  not ParseState::is_in_situ_strings,
+			  "options::InSituStrings is only supported by from_json and "
+			  "from_json_array, a json_value can be read more than once" );
 			BasicParsePolicy<PolicyFlags, Allocator> m_parse_state{ };
 			using CharT = typename ParseState::CharT;
 			using iterator = basic_json_value_iterator<PolicyFlags, Allocator>;
@@ -0,0 +1,141 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include <ciso646>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief Run a fixed set of tasks on a group of threads.  Each worker
+			/// starts with a contiguous block of the tasks and takes them from the
+			/// front of its queue.  When it runs out it steals from the back of
+			/// another worker's queue, so uneven tasks still finish together.  No
+			/// tasks are added after the start, so once every queue is empty the
+			/// work is done
+			class work_stealing_pool {
+				struct worker_queue {
+					std::mutex mutex{ };
+					std::deque<std::size_t> tasks{ };
+				};
+
+				std::unique_ptr<worker_queue[]> m_queues;
+				std::size_t m_worker_count;
+
+				[[nodiscard]] std::optional<std::size_t> pop( std::size_t worker ) {
+					auto &q = m_queues[worker];
+					auto const lck = std::lock_guard<std::mutex>( q.mutex );
+					if( q.tasks.empty( ) ) {
+						return std::nullopt;
+					}
+					std::size_t const result = q.tasks.front( );
+					q.tasks.pop_front( );
+					return result;
+				}
+
+				[[nodiscard]] std::optional<std::size_t> steal( std::size_t worker ) {
+					for( std::size_t n = 1; n < m_worker_count; ++n ) {
+						auto &q = m_queues[( worker + n ) % m_worker_count];
+						auto const lck = std::lock_guard<std::mutex>( q.mutex );
+						if( not q.tasks.empty( ) ) {
+							std::size_t const result = q.tasks.back( );
+							q.tasks.pop_back( );
+							return result;
+						}
+					}
+					return std::nullopt;
+				}
+
+				template<typename Task>
+				void work( std::size_t worker, Task const &task ) {
+					while( true ) {
+						auto idx = pop( worker );
+						if( not idx ) {
+							idx = steal( worker );
+							if( not idx ) {
+								return;
+							}
+						}
+						task( *idx );
+					}
+				}
+
+				work_stealing_pool( std::size_t task_count, std::size_t worker_count )
+				  : m_queues( std::make_unique<worker_queue[]>( worker_count ) )
+				  , m_worker_count( worker_count ) {
+					for( std::size_t w = 0; w < worker_count; ++w ) {
+						std::size_t const first = w * task_count / worker_count;
+						std::size_t const last = ( w + 1U ) * task_count / worker_count;
+						for( std::size_t n = first; n < last; ++n ) {
+							m_queues[w].tasks.push_back( n );
+						}
+					}
+				}
+
+			public:
+				/// @brief Call task( n ) for each n in [0, task_count) on up to
+				/// thread_count threads, including the calling thread.  If tasks
+				/// throw, the exception of the first task in order is rethrown after
+				/// all of the tasks have run
+				template<typename Task>
+				static void run( std::size_t task_count, std::size_t thread_count,
+				                 Task const &task ) {
+					if( thread_count > task_count ) {
+						thread_count = task_count;
+					}
+					if( thread_count <= 1 ) {
+						for( std::size_t n = 0; n < task_count; ++n ) {
+							task( n );
+						}
+						return;
+					}
+#if defined( DAW_USE_EXCEPTIONS )
+					auto errors = std::vector<std::exception_ptr>( task_count );
+					auto const checked_task = [&]( std::size_t n ) {
+						try {
+							task( n );
+						} catch( ... ) { errors[n] = std::current_exception( ); }
+					};
+#else
+					auto const &checked_task = task;
+#endif
+					auto pool = work_stealing_pool( task_count, thread_count );
+					auto threads = std::vector<std::thread>( );
+					threads.reserve( thread_count - 1U );
+					for( std::size_t w = 1; w < thread_count; ++w ) {
+						threads.emplace_back( [&pool, &checked_task, w] {
+							pool.work( w, checked_task );
+						} );
+					}
+					pool.work( 0, checked_task );
+					for( auto &t : threads ) {
+						t.join( );
+					}
+#if defined( DAW_USE_EXCEPTIONS )
+					for( auto const &e : errors ) {
+						if( e ) {
+							std::rethrow_exception( e );
+						}
+					}
+#endif
+				}
+			};
+		} // namespace json_details
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
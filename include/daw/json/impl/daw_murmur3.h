@@ -67,6 +67,74 @@ namespace daw {
 		return hash;
 	}
 
+	namespace name_hash_details {
+		// Compilers turn these into a single load
+		template<std::size_t N, typename CharT>
+		[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::uint64_t
+		load_le( CharT const *ptr ) {
+			std::uint64_t result = 0;
+			for( std::size_t n = 0; n < N; ++n ) {
+				result |= static_cast<std::uint64_t>(
+				            static_cast<unsigned char>( ptr[n] ) )
+				          << ( 8U * n );
+			}
+			return result;
+		}
+
+		[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::uint64_t
+		word_step( std::uint64_t h, std::uint64_t w ) {
+			h = ( h ^ w ) * 0x9FB2'1C65'1E98'DF25ULL;
+			return h ^ ( h >> 47U );
+		}
+	} // namespace name_hash_details
+
+	/***
+	 * Hash a string 8 bytes at a time.  Strings of 8 or more bytes end with the
+	 * last 8 bytes, which may overlap the previous word, so there is no byte
+	 * loop for the tail.  Shorter strings use two overlapping 4 byte loads.
+	 * When expect_long_strings is true, two words are mixed per step
+	 * @pre std::size( key ) >= 4
+	 */
+	template<bool expect_long_strings, typename StringView>
+	[[nodiscard]] DAW_ATTRIB_FLATTEN constexpr auto word_hash_32( StringView key )
+	  -> std::enable_if_t<daw::traits::is_string_view_like_v<StringView>,
+	                      UInt32> {
+		using namespace name_hash_details;
+		std::size_t len = std::size( key );
+		auto const *ptr = std::data( key );
+		std::uint64_t h =
+		  0x9E37'79B9'7F4A'7C15ULL ^ ( static_cast<std::uint64_t>( len ) *
+		                               0xC2B2'AE3D'27D4'EB4FULL );
+		if( len < 8 ) {
+			h = word_step( h, ( load_le<4>( ptr ) << 32U ) |
+			                    load_le<4>( ptr + ( len - 4 ) ) );
+		} else {
+			if constexpr( expect_long_strings ) {
+				while( len > 16 ) {
+					h = word_step( word_step( h, load_le<8>( ptr ) ),
+					               load_le<8>( ptr + 8 ) );
+					ptr += 16;
+					len -= 16;
+				}
+			}
+			while( len > 8 ) {
+				h = word_step( h, load_le<8>( ptr ) );
+				ptr += 8;
+				len -= 8;
+			}
+			h = word_step( h, load_le<8>( ptr + ( len - 8 ) ) );
+		}
+		h *= 0xFF51'AFD7'ED55'8CCDULL;
+		h ^= h >> 32U;
+		return to_uint32( static_cast<std::uint32_t>( h ) );
+	}
+
+	/***
+	 * The hash of member names.  Names of up to 4 bytes are their bytes, so
+	 * they never collide with each other.  Longer names use word_hash_32.  The
+	 * result does not depend on expect_long_strings, as hashes made at compile
+	 * time are compared to those of the document
+	 */
 	template<bool expect_long_strings>
 	[[nodiscard]] DAW_ATTRIB_INLINE constexpr UInt32
 	name_hash( daw::string_view key ) {
@@ -80,7 +148,7 @@ namespace daw {
 			}
 			return result;
 		}
-		return fnv1a_32<expect_long_strings>( key );
+		return word_hash_32<expect_long_strings>( key );
 	}
 
 	template<typename StringView>
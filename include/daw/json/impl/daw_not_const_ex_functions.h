@@ -11,6 +11,7 @@
 #include "version.h"
 
 #include "daw_json_assert.h"
+#include "daw_json_cpu_dispatch.h"
 #include "daw_json_exec_modes.h"
 
 #include <daw/daw_attributes.h>
@@ -32,10 +33,14 @@
 #include <intrin.h>
 #endif
 #endif
+#if defined( DAW_ALLOW_AVX2 )
+#include <immintrin.h>
+#endif
 
 #include <ciso646>
 #include <cstddef>
 #include <cstring>
+#include <type_traits>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
@@ -51,7 +56,54 @@ namespace daw::json {
 				return *( ptr - 2 ) != '\\';
 			}
 
-#if defined( DAW_ALLOW_SSE42 )
+			/***
+			 * Count the elements of a non-empty array of numbers.  first is at the
+			 * first element.  Only number characters, commas and whitespace may
+			 * come before the closing bracket
+			 * @param separators The commas already counted before first
+			 * @return The number of elements, or -1 when the array has other values
+			 * or is not closed before last
+			 */
+			template<typename CharT>
+			constexpr std::ptrdiff_t
+			count_number_array_elements( constexpr_exec_tag, CharT *first,
+			                             CharT *const last,
+			                             std::ptrdiff_t separators = 0 ) {
+				for( ; first < last; ++first ) {
+					switch( *first ) {
+					case ']':
+						return separators + 1;
+					case ',':
+						++separators;
+						break;
+					case '0':
+					case '1':
+					case '2':
+					case '3':
+					case '4':
+					case '5':
+					case '6':
+					case '7':
+					case '8':
+					case '9':
+					case '-':
+					case '+':
+					case '.':
+					case 'e':
+					case 'E':
+					case ' ':
+					case '\t':
+					case '\n':
+					case '\r':
+						break;
+					default:
+						return -1;
+					}
+				}
+				return -1;
+			}
+
+#if defined( DAW_ALLOW_SSE42 ) or defined( DAW_JSON_HAS_CPU_DISPATCH )
 			struct key_table_t {
 				alignas( 16 ) bool values[256] = { };
 
@@ -69,6 +121,36 @@ namespace daw::json {
 			}( );
 #endif
 
+			/***
+			 * The block size of the SIMD exec tags and of the block tags of the
+			 * dispatched kernels
+			 */
+			template<typename ExecTag>
+			inline constexpr std::ptrdiff_t char_block_size_v = 16;
+
+			DAW_ATTRIB_INLINE constexpr bool is_json_whitespace( char c ) {
+				return ( static_cast<unsigned>( static_cast<unsigned char>( c ) ) -
+				         1U ) <= 0x1FU;
+			}
+
+			/***
+			 * The characters of a block escaped by a backslash, see
+			 * cpu_dispatch::find_escaped.  prev_escaped carries a backslash run
+			 * that ends the block into the next one
+			 */
+			template<typename ExecTag>
+			DAW_ATTRIB_INLINE UInt32 find_escaped_in_block( ExecTag,
+			                                                UInt32 &prev_escaped,
+			                                                UInt32 backslashes ) {
+				constexpr auto block_size =
+				  static_cast<unsigned>( char_block_size_v<ExecTag> );
+				auto prev = static_cast<std::uint32_t>( prev_escaped );
+				auto const result = cpu_dispatch::find_escaped<block_size>(
+				  prev, static_cast<std::uint32_t>( backslashes ) );
+				prev_escaped = static_cast<UInt32>( prev );
+				return static_cast<UInt32>( result );
+			}
+
 			inline std::ptrdiff_t find_lsb_set( runtime_exec_tag, UInt32 value ) {
 #if DAW_HAS_BUILTIN( __builtin_ffs )
 				return __builtin_ffs( static_cast<int>( value ) ) - 1;
@@ -89,6 +171,23 @@ namespace daw::json {
 #endif
 			}
 
+			inline std::ptrdiff_t count_set_bits( runtime_exec_tag, UInt32 value ) {
+#if DAW_HAS_BUILTIN( __builtin_popcount )
+				return __builtin_popcount( static_cast<unsigned>( value ) );
+#elif defined( _MSC_VER )
+				return static_cast<std::ptrdiff_t>(
+				  __popcnt( static_cast<unsigned>( value ) ) );
+#else
+				auto v = static_cast<std::uint32_t>( value );
+				std::ptrdiff_t result = 0;
+				while( v != 0 ) {
+					v &= v - 1U;
+					++result;
+				}
+				return result;
+#endif
+			}
+
 #if defined( DAW_ALLOW_SSE42 )
 			DAW_ATTRIB_INLINE __m128i
 			set_reverse( char c0, char c1 = 0, char c2 = 0, char c3 = 0, char c4 = 0,
@@ -109,6 +208,19 @@ namespace daw::json {
 				return _mm_load_si128( reinterpret_cast<__m128i const *>( ptr ) );
 			}
 
+			/***
+			 * The full width block load of the SIMD exec tags
+			 */
+			DAW_ATTRIB_INLINE __m128i load_char_block( sse42_exec_tag tag,
+			                                           char const *ptr ) {
+				return uload16_char_data( tag, ptr );
+			}
+
+			DAW_ATTRIB_INLINE void store_char_block( sse42_exec_tag, char *ptr,
+			                                         __m128i block ) {
+				_mm_storeu_si128( reinterpret_cast<__m128i *>( ptr ), block );
+			}
+
 			template<char k>
 			DAW_ATTRIB_INLINE UInt32 mem_find_eq( sse42_exec_tag, __m128i block ) {
 				__m128i const keys = _mm_set1_epi8( k );
@@ -123,33 +235,6 @@ namespace daw::json {
 				return to_uint32( _mm_movemask_epi8( found ) );
 			}
 
-			template<bool is_unchecked_input, char... keys, typename CharT>
-			DAW_ATTRIB_INLINE CharT *mem_move_to_next_of( sse42_exec_tag tag,
-			                                              CharT *first,
-			                                              CharT *const last ) {
-
-				while( last - first >= 16 ) {
-					auto const val0 = uload16_char_data( tag, first );
-					auto const key_positions = ( mem_find_eq<keys>( tag, val0 ) | ... );
-					if( key_positions != 0 ) {
-						return first + find_lsb_set( tag, key_positions );
-					}
-					first += 16;
-				}
-				__m128i val1{ };
-				auto const max_pos = last - first;
-				memcpy( &val1, first, static_cast<std::size_t>( max_pos ) );
-				auto const key_positions = ( mem_find_eq<keys>( tag, val1 ) | ... );
-				if( key_positions != 0 ) {
-					auto const offset = find_lsb_set( tag, key_positions );
-					if( offset >= max_pos ) {
-						return last;
-					}
-					return first + offset;
-				}
-				return last;
-			}
-
 			template<bool is_unchecked_input, char... keys, typename CharT>
 			DAW_ATTRIB_INLINE CharT *
 			mem_move_to_next_not_of( sse42_exec_tag tag, CharT *first, CharT *last ) {
@@ -169,16 +254,58 @@ namespace daw::json {
 						return first;
 					}
 				}
-				__m128i b{ };
 				auto const max_pos = last - first;
-				int const result =
-				  _mm_cmpestri( a, keys_len::vlaue, b, 16, compare_mode::value );
+				if( max_pos <= 0 ) {
+					return last;
+				}
+				__m128i b{ };
+				memcpy( &b, first, static_cast<std::size_t>( max_pos ) );
+				// Only the first max_pos bytes of b are compared
+				int const result = _mm_cmpestri( a, keys_len::value, b,
+				                                 static_cast<int>( max_pos ),
+				                                 compare_mode::value );
 				if( result < max_pos ) {
 					return first + result;
 				}
 				return last;
 			}
 
+			/// @brief The bytes of block that are not whitespace by the same
+			/// predicate as the policies trim_left, a byte in [1, 0x20]
+			DAW_ATTRIB_INLINE UInt32 find_not_whitespace( sse42_exec_tag,
+			                                              __m128i block ) {
+				__m128i const shifted = _mm_sub_epi8( block, _mm_set1_epi8( 1 ) );
+				__m128i const is_ws = _mm_cmpeq_epi8(
+				  _mm_min_epu8( shifted, _mm_set1_epi8( 0x1F ) ), shifted );
+				return to_uint32( ~_mm_movemask_epi8( is_ws ) & 0xFFFF );
+			}
+
+			/// @brief The bytes of block that are control characters, < 0x20
+			DAW_ATTRIB_INLINE UInt32 find_control_chars( sse42_exec_tag,
+			                                             __m128i block ) {
+				__m128i const is_ctrl = _mm_cmpeq_epi8(
+				  _mm_min_epu8( block, _mm_set1_epi8( 0x1F ) ), block );
+				return to_uint32( _mm_movemask_epi8( is_ctrl ) );
+			}
+
+			/// @brief The bytes of block that are not ASCII
+			DAW_ATTRIB_INLINE UInt32 find_high_bit( sse42_exec_tag, __m128i block ) {
+				return to_uint32( _mm_movemask_epi8( block ) );
+			}
+
+			/// @brief The bytes of block that can be part of a number, the digits,
+			/// signs, decimal point and exponent
+			DAW_ATTRIB_INLINE UInt32 find_number_chars( sse42_exec_tag tag,
+			                                            __m128i block ) {
+				__m128i const is_digit =
+				  _mm_and_si128( _mm_cmpgt_epi8( block, _mm_set1_epi8( '0' - 1 ) ),
+				                 _mm_cmplt_epi8( block, _mm_set1_epi8( '9' + 1 ) ) );
+				return to_uint32( _mm_movemask_epi8( is_digit ) ) |
+				       mem_find_eq<'-'>( tag, block ) | mem_find_eq<'+'>( tag, block ) |
+				       mem_find_eq<'.'>( tag, block ) | mem_find_eq<'e'>( tag, block ) |
+				       mem_find_eq<'E'>( tag, block );
+			}
+
 			template<typename U32>
 			DAW_ATTRIB_INLINE bool add_overflow( U32 value1, U32 value2,
 			                                     U32 &result ) {
@@ -241,23 +368,268 @@ namespace daw::json {
 				return to_uint32( _mm_cvtsi128_si32( result ) );
 			}
 
-			template<bool is_unchecked_input, typename CharT>
-			inline CharT *mem_skip_until_end_of_string( simd_exec_tag tag,
-			                                            CharT *first,
-			                                            CharT *const last ) {
+#endif
+#if defined( DAW_ALLOW_AVX2 )
+			DAW_ATTRIB_INLINE __m256i uload32_char_data( avx2_exec_tag,
+			                                             char const *ptr ) {
+				return _mm256_loadu_si256( reinterpret_cast<__m256i const *>( ptr ) );
+			}
+
+			template<>
+			inline constexpr std::ptrdiff_t char_block_size_v<avx2_exec_tag> = 32;
+
+			DAW_ATTRIB_INLINE __m256i load_char_block( avx2_exec_tag tag,
+			                                           char const *ptr ) {
+				return uload32_char_data( tag, ptr );
+			}
+
+			DAW_ATTRIB_INLINE void store_char_block( avx2_exec_tag, char *ptr,
+			                                         __m256i block ) {
+				_mm256_storeu_si256( reinterpret_cast<__m256i *>( ptr ), block );
+			}
+
+			template<char k>
+			DAW_ATTRIB_INLINE UInt32 mem_find_eq( avx2_exec_tag, __m256i block ) {
+				__m256i const keys = _mm256_set1_epi8( k );
+				__m256i const found = _mm256_cmpeq_epi8( block, keys );
+				return to_uint32(
+				  static_cast<std::uint32_t>( _mm256_movemask_epi8( found ) ) );
+			}
+
+			DAW_ATTRIB_INLINE UInt32 find_not_whitespace( avx2_exec_tag,
+			                                              __m256i block ) {
+				__m256i const shifted = _mm256_sub_epi8( block, _mm256_set1_epi8( 1 ) );
+				__m256i const is_ws = _mm256_cmpeq_epi8(
+				  _mm256_min_epu8( shifted, _mm256_set1_epi8( 0x1F ) ), shifted );
+				return to_uint32(
+				  ~static_cast<std::uint32_t>( _mm256_movemask_epi8( is_ws ) ) );
+			}
+
+			DAW_ATTRIB_INLINE UInt32 find_control_chars( avx2_exec_tag,
+			                                             __m256i block ) {
+				__m256i const is_ctrl = _mm256_cmpeq_epi8(
+				  _mm256_min_epu8( block, _mm256_set1_epi8( 0x1F ) ), block );
+				return to_uint32(
+				  static_cast<std::uint32_t>( _mm256_movemask_epi8( is_ctrl ) ) );
+			}
+
+			DAW_ATTRIB_INLINE UInt32 find_high_bit( avx2_exec_tag, __m256i block ) {
+				return to_uint32(
+				  static_cast<std::uint32_t>( _mm256_movemask_epi8( block ) ) );
+			}
+
+			DAW_ATTRIB_INLINE UInt32 find_number_chars( avx2_exec_tag tag,
+			                                            __m256i block ) {
+				__m256i const is_digit = _mm256_and_si256(
+				  _mm256_cmpgt_epi8( block, _mm256_set1_epi8( '0' - 1 ) ),
+				  _mm256_cmpgt_epi8( _mm256_set1_epi8( '9' + 1 ), block ) );
+				auto const digits =
+				  static_cast<std::uint32_t>( _mm256_movemask_epi8( is_digit ) );
+				return to_uint32( digits ) | mem_find_eq<'-'>( tag, block ) |
+				       mem_find_eq<'+'>( tag, block ) | mem_find_eq<'.'>( tag, block ) |
+				       mem_find_eq<'e'>( tag, block ) | mem_find_eq<'E'>( tag, block );
+			}
+
+			/// The 32 byte block version of find_escaped_branchless.  The carry out
+			/// of bit 31 does not fit in the 32bit mask, so the arithmetic is done
+			/// with 64bits
+			DAW_ATTRIB_INLINE UInt32 find_escaped_branchless( avx2_exec_tag tag,
+			                                                  UInt32 &prev_escaped,
+			                                                  UInt32 backslashes ) {
+				return find_escaped_in_block( tag, prev_escaped, backslashes );
+			}
+
+			DAW_ATTRIB_INLINE UInt32 prefix_xor( avx2_exec_tag, UInt32 bitmask ) {
+				// The carryless multiply is on the low 64bits, so all 32 bits of the
+				// mask are covered
+				__m128i const all_ones = _mm_set1_epi8( '\xFF' );
+				__m128i const result = _mm_clmulepi64_si128(
+				  _mm_set_epi64x( 0, static_cast<long long>(
+				                       static_cast<std::uint32_t>( bitmask ) ) ),
+				  all_ones, 0 );
+				return to_uint32(
+				  static_cast<std::uint32_t>( _mm_cvtsi128_si32( result ) ) );
+			}
+#endif
+#if defined( DAW_ALLOW_SSE42 )
+			/***
+			 * The bytes of the block at ptr that are one of keys, and those that
+			 * are not whitespace.  The width generic kernels below only use these
+			 * and the scalar mask helpers, so no vector is passed between
+			 * functions when they are instantiated for a dispatched block tag
+			 */
+			template<char... keys, typename ExecTag,
+			         std::enable_if_t<std::is_base_of_v<sse42_exec_tag, ExecTag>,
+			                          std::nullptr_t> = nullptr>
+			DAW_ATTRIB_INLINE UInt32 block_find_eq( ExecTag tag, char const *ptr ) {
+				auto const block = load_char_block( tag, ptr );
+				return ( mem_find_eq<keys>( tag, block ) | ... );
+			}
+
+			template<typename ExecTag,
+			         std::enable_if_t<std::is_base_of_v<sse42_exec_tag, ExecTag>,
+			                          std::nullptr_t> = nullptr>
+			DAW_ATTRIB_INLINE UInt32 block_find_not_whitespace( ExecTag tag,
+			                                                    char const *ptr ) {
+				return find_not_whitespace( tag, load_char_block( tag, ptr ) );
+			}
+
+			static_assert( static_cast<std::size_t>(
+			                 char_block_size_v<sse42_exec_tag> ) <= json_input_padding );
+#endif
+#if defined( DAW_JSON_HAS_CPU_DISPATCH )
+			/***
+			 * The block operations of the dispatched kernels.  SSE2 is part of
+			 * x86-64, the AVX2 ones are compiled with a target attribute and are
+			 * inlined into the AVX2 entry points of cpu_dispatch
+			 */
+			template<>
+			inline constexpr std::ptrdiff_t
+			  char_block_size_v<cpu_dispatch::avx2_block_tag> = 32;
+
+			template<char... keys>
+			DAW_ATTRIB_INLINE UInt32 block_find_eq( cpu_dispatch::sse2_block_tag,
+			                                        char const *ptr ) {
+				__m128i const block =
+				  _mm_loadu_si128( reinterpret_cast<__m128i const *>( ptr ) );
+				return ( to_uint32( _mm_movemask_epi8(
+				           _mm_cmpeq_epi8( block, _mm_set1_epi8( keys ) ) ) ) |
+				         ... );
+			}
+
+			DAW_ATTRIB_INLINE UInt32
+			block_find_not_whitespace( cpu_dispatch::sse2_block_tag,
+			                           char const *ptr ) {
+				__m128i const shifted = _mm_sub_epi8(
+				  _mm_loadu_si128( reinterpret_cast<__m128i const *>( ptr ) ),
+				  _mm_set1_epi8( 1 ) );
+				__m128i const is_ws = _mm_cmpeq_epi8(
+				  _mm_min_epu8( shifted, _mm_set1_epi8( 0x1F ) ), shifted );
+				return to_uint32( ~_mm_movemask_epi8( is_ws ) & 0xFFFF );
+			}
+
+			template<char... keys>
+			DAW_JSON_TARGET_AVX2 inline UInt32
+			block_find_eq( cpu_dispatch::avx2_block_tag, char const *ptr ) {
+				__m256i const block =
+				  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( ptr ) );
+				return ( to_uint32( static_cast<std::uint32_t>( _mm256_movemask_epi8(
+				           _mm256_cmpeq_epi8( block, _mm256_set1_epi8( keys ) ) ) ) ) |
+				         ... );
+			}
+
+			DAW_JSON_TARGET_AVX2 inline UInt32
+			block_find_not_whitespace( cpu_dispatch::avx2_block_tag,
+			                           char const *ptr ) {
+				__m256i const shifted = _mm256_sub_epi8(
+				  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( ptr ) ),
+				  _mm256_set1_epi8( 1 ) );
+				__m256i const is_ws = _mm256_cmpeq_epi8(
+				  _mm256_min_epu8( shifted, _mm256_set1_epi8( 0x1F ) ), shifted );
+				return to_uint32(
+				  ~static_cast<std::uint32_t>( _mm256_movemask_epi8( is_ws ) ) );
+			}
+#endif
+#if defined( DAW_ALLOW_SSE42 ) or defined( DAW_JSON_HAS_CPU_DISPATCH )
+			/***
+			 * Find the next of keys a block at a time.  These width generic
+			 * kernels are used by the SIMD exec tags and, instantiated with the
+			 * block tags of cpu_dispatch, by dispatch_exec_tag
+			 * @return The position of the match, or last when there is none
+			 */
+			template<char... keys, typename ExecTag, typename CharT>
+			DAW_ATTRIB_INLINE CharT *mem_move_to_next_of_blocks( ExecTag,
+			                                                     CharT *first,
+			                                                     CharT *const last ) {
+				constexpr auto tag = ExecTag{ };
+				constexpr auto block_size = char_block_size_v<ExecTag>;
+				while( last - first >= block_size ) {
+					UInt32 const found = block_find_eq<keys...>( tag, first );
+					if( found != 0 ) {
+						return first + find_lsb_set( tag, found );
+					}
+					first += block_size;
+				}
+				while( first < last and not( ( *first == keys ) | ... ) ) {
+					++first;
+				}
+				return first;
+			}
+
+			/***
+			 * Skip the whitespace at first.  Most JSON has very little whitespace
+			 * so the first byte is checked before going wide, pretty printed
+			 * documents have runs of indentation that are skipped a block at a time
+			 */
+			template<typename ExecTag, typename CharT>
+			DAW_ATTRIB_INLINE CharT *mem_skip_whitespace_blocks( ExecTag,
+			                                                     CharT *first,
+			                                                     CharT *const last ) {
+				if( first >= last or not is_json_whitespace( *first ) ) {
+					return first;
+				}
+				constexpr auto tag = ExecTag{ };
+				constexpr auto block_size = char_block_size_v<ExecTag>;
+				++first;
+				while( last - first >= block_size ) {
+					UInt32 const not_ws = block_find_not_whitespace( tag, first );
+					if( not_ws != 0 ) {
+						return first + find_lsb_set( tag, not_ws );
+					}
+					first += block_size;
+				}
+				while( first < last and is_json_whitespace( *first ) ) {
+					++first;
+				}
+				return first;
+			}
+
+			/***
+			 * Find the closing quote of a string a block at a time, first is after
+			 * the opening quote.  A backslash run that ends a block carries into
+			 * the next one, and the bytes after the last full block are checked
+			 * one at a time
+			 * @param first_escape When negative, it is set to the offset from first
+			 * of the first backslash in the string.  The string has no escapes
+			 * when it is still negative
+			 * @return The position of the closing quote, or last when there is
+			 * none
+			 */
+			template<bool is_unchecked_input, typename ExecTag, typename CharT>
+			inline CharT *mem_skip_string_blocks( ExecTag, CharT *first,
+			                                      CharT *const last,
+			                                      std::ptrdiff_t &first_escape ) {
+				constexpr auto tag = ExecTag{ };
+				constexpr auto block_size = char_block_size_v<ExecTag>;
+				CharT *const first_first = first;
 				UInt32 prev_escapes = 0_u32;
-				while( last - first >= 16 ) {
-					auto const val0 = uload16_char_data( tag, first );
-					UInt32 const backslashes = mem_find_eq<'\\'>( tag, val0 );
+				while( last - first >= block_size ) {
+					UInt32 const backslashes = block_find_eq<'\\'>( tag, first );
 					UInt32 const escaped =
-					  find_escaped_branchless( tag, prev_escapes, backslashes );
-					UInt32 const quotes = mem_find_eq<'"'>( tag, val0 ) & ( ~escaped );
-					UInt32 const in_string = prefix_xor( tag, quotes );
-					if( in_string != 0 ) {
-						first += find_lsb_set( tag, in_string );
-						return first;
+					  find_escaped_in_block( tag, prev_escapes, backslashes );
+					// The first unescaped quote ends the string, there is no need to
+					// compute the in string mask
+					UInt32 const quotes = block_find_eq<'"'>( tag, first ) & ( ~escaped );
+					if( quotes != 0 ) {
+						auto const quote_pos = find_lsb_set( tag, quotes );
+						if( ( backslashes != 0 ) & ( first_escape < 0 ) ) {
+							// Only escapes prior to the closing quote are part of the string
+							auto const escape_pos = find_lsb_set( tag, backslashes );
+							if( escape_pos < quote_pos ) {
+								first_escape = ( first - first_first ) + escape_pos;
+							}
+						}
+						return first + quote_pos;
 					}
-					first += 16;
+					if( ( backslashes != 0 ) & ( first_escape < 0 ) ) {
+						first_escape =
+						  ( first - first_first ) + find_lsb_set( tag, backslashes );
+					}
+					first += block_size;
+				}
+				if( ( prev_escapes != 0 ) & ( first < last ) ) {
+					// The previous block ended with an escape, skip the escaped character
+					++first;
 				}
 				if constexpr( is_unchecked_input ) {
 					while( *first != '"' ) {
@@ -267,6 +639,9 @@ namespace daw::json {
 						if( *first == '"' ) {
 							return first;
 						}
+						if( first_escape < 0 ) {
+							first_escape = first - first_first;
+						}
 						first += 2;
 					}
 				} else {
@@ -281,72 +656,466 @@ namespace daw::json {
 						if( *first == '"' ) {
 							return first;
 						}
+						if( first_escape < 0 ) {
+							first_escape = first - first_first;
+						}
 						first += 2;
 					}
 				}
 				return ( is_unchecked_input or DAW_LIKELY( first < last ) ) ? first
 				                                                            : last;
 			}
+#endif
+#if defined( DAW_ALLOW_SSE42 )
+			template<bool is_unchecked_input, char... keys, typename CharT>
+			DAW_ATTRIB_INLINE CharT *mem_move_to_next_of( simd_exec_tag tag,
+			                                              CharT *first,
+			                                              CharT *const last ) {
+				return mem_move_to_next_of_blocks<keys...>( tag, first, last );
+			}
+
+			template<typename CharT>
+			DAW_ATTRIB_INLINE CharT *
+			mem_skip_whitespace( simd_exec_tag tag, CharT *first, CharT *last ) {
+				return mem_skip_whitespace_blocks( tag, first, last );
+			}
 
 			template<bool is_unchecked_input, typename CharT>
 			inline CharT *
 			mem_skip_until_end_of_string( simd_exec_tag tag, CharT *first,
 			                              CharT *const last,
 			                              std::ptrdiff_t &first_escape ) {
-				CharT *const first_first = first;
+				return mem_skip_string_blocks<is_unchecked_input>( tag, first, last,
+				                                                   first_escape );
+			}
+
+			template<bool is_unchecked_input, typename CharT>
+			inline CharT *mem_skip_until_end_of_string( simd_exec_tag tag,
+			                                            CharT *first,
+			                                            CharT *const last ) {
+				// A non-negative value tells the kernel not to look for escapes
+				std::ptrdiff_t first_escape = 0;
+				return mem_skip_string_blocks<is_unchecked_input>( tag, first, last,
+				                                                   first_escape );
+			}
+#if defined( DAW_ALLOW_AVX2 )
+			template<bool is_unchecked_input, char... keys, typename CharT>
+			DAW_ATTRIB_INLINE CharT *mem_move_to_next_of( avx2_exec_tag tag,
+			                                              CharT *first,
+			                                              CharT *const last ) {
+				return mem_move_to_next_of_blocks<keys...>( tag, first, last );
+			}
+
+			template<typename CharT>
+			DAW_ATTRIB_INLINE CharT *
+			mem_skip_whitespace( avx2_exec_tag tag, CharT *first, CharT *last ) {
+				return mem_skip_whitespace_blocks( tag, first, last );
+			}
+
+			template<bool is_unchecked_input, typename CharT>
+			inline CharT *
+			mem_skip_until_end_of_string( avx2_exec_tag tag, CharT *first,
+			                              CharT *const last,
+			                              std::ptrdiff_t &first_escape ) {
+				return mem_skip_string_blocks<is_unchecked_input>( tag, first, last,
+				                                                   first_escape );
+			}
+
+			template<bool is_unchecked_input, typename CharT>
+			inline CharT *mem_skip_until_end_of_string( avx2_exec_tag tag,
+			                                            CharT *first,
+			                                            CharT *const last ) {
+				std::ptrdiff_t first_escape = 0;
+				return mem_skip_string_blocks<is_unchecked_input>( tag, first, last,
+				                                                   first_escape );
+			}
+#endif
+
+			/***
+			 * padded_exec_tag kernels.  The document is followed by at least
+			 * json_input_padding readable bytes, so every load is a full block and
+			 * there is no tail loop.  A match past last is in the padding and is
+			 * reported as last
+			 */
+			template<bool is_unchecked_input, char... keys, typename ExecTag,
+			         typename CharT>
+			DAW_ATTRIB_INLINE CharT *mem_move_to_next_of( padded_exec_tag<ExecTag>,
+			                                              CharT *first,
+			                                              CharT *const last ) {
+				constexpr auto tag = ExecTag{ };
+				while( first < last ) {
+					auto const val0 = load_char_block( tag, first );
+					auto const key_positions = ( mem_find_eq<keys>( tag, val0 ) | ... );
+					if( key_positions != 0 ) {
+						first += find_lsb_set( tag, key_positions );
+						return first < last ? first : last;
+					}
+					first += char_block_size_v<ExecTag>;
+				}
+				return last;
+			}
+
+			template<typename ExecTag, typename CharT>
+			DAW_ATTRIB_INLINE CharT *mem_skip_whitespace( padded_exec_tag<ExecTag>,
+			                                              CharT *first,
+			                                              CharT *const last ) {
+				if( first >= last or not is_json_whitespace( *first ) ) {
+					return first;
+				}
+				constexpr auto tag = ExecTag{ };
+				++first;
+				while( first < last ) {
+					UInt32 const not_ws =
+					  find_not_whitespace( tag, load_char_block( tag, first ) );
+					if( not_ws != 0 ) {
+						first += find_lsb_set( tag, not_ws );
+						return first < last ? first : last;
+					}
+					first += char_block_size_v<ExecTag>;
+				}
+				return last;
+			}
+
+			template<bool is_unchecked_input, typename ExecTag, typename CharT>
+			inline CharT *mem_skip_until_end_of_string( padded_exec_tag<ExecTag>,
+			                                            CharT *first,
+			                                            CharT *const last ) {
+				constexpr auto tag = ExecTag{ };
 				UInt32 prev_escapes = 0_u32;
-				while( last - first >= 16 ) {
-					auto const val0 = uload16_char_data( tag, first );
+				while( first < last ) {
+					auto const val0 = load_char_block( tag, first );
 					UInt32 const backslashes = mem_find_eq<'\\'>( tag, val0 );
-					if( ( backslashes != 0 ) & ( first_escape < 0 ) ) {
-						first_escape = find_lsb_set( tag, backslashes );
-					}
 					UInt32 const escaped =
 					  find_escaped_branchless( tag, prev_escapes, backslashes );
 					UInt32 const quotes = mem_find_eq<'"'>( tag, val0 ) & ( ~escaped );
 					UInt32 const in_string = prefix_xor( tag, quotes );
 					if( in_string != 0 ) {
 						first += find_lsb_set( tag, in_string );
-						return first;
+						return first < last ? first : last;
 					}
-					first += 16;
+					first += char_block_size_v<ExecTag>;
 				}
-				if constexpr( is_unchecked_input ) {
-					while( *first != '"' ) {
-						while( not key_table<'"', '\\'>[*first] ) {
-							++first;
-						}
-						if( *first == '"' ) {
-							return first;
-						}
-						if( first_escape < 0 ) {
-							first_escape = first_first - first;
+				return last;
+			}
+
+			template<bool is_unchecked_input, typename ExecTag, typename CharT>
+			inline CharT *
+			mem_skip_until_end_of_string( padded_exec_tag<ExecTag>, CharT *first,
+			                              CharT *const last,
+			                              std::ptrdiff_t &first_escape ) {
+				constexpr auto tag = ExecTag{ };
+				CharT *const first_first = first;
+				UInt32 prev_escapes = 0_u32;
+				while( first < last ) {
+					auto const val0 = load_char_block( tag, first );
+					UInt32 const backslashes = mem_find_eq<'\\'>( tag, val0 );
+					UInt32 const escaped =
+					  find_escaped_branchless( tag, prev_escapes, backslashes );
+					UInt32 const quotes = mem_find_eq<'"'>( tag, val0 ) & ( ~escaped );
+					UInt32 const in_string = prefix_xor( tag, quotes );
+					if( in_string != 0 ) {
+						auto const quote_pos = find_lsb_set( tag, in_string );
+						if( ( backslashes != 0 ) & ( first_escape < 0 ) ) {
+							// Only escapes prior to the closing quote are part of the string
+							auto const escape_pos = find_lsb_set( tag, backslashes );
+							if( escape_pos < quote_pos ) {
+								first_escape = ( first - first_first ) + escape_pos;
+							}
 						}
-						first += 2;
+						first += quote_pos;
+						return first < last ? first : last;
 					}
-				} else {
-					while( DAW_LIKELY( first < last ) and *first != '"' ) {
-						while( DAW_LIKELY( first < last ) and
-						       not key_table<'"', '\\'>[*first] ) {
-							++first;
-						}
-						if( first >= last ) {
-							return last;
-						}
-						if( *first == '"' ) {
-							return first;
-						}
-						if( first_escape < 0 ) {
-							first_escape = first_first - first;
+					if( ( backslashes != 0 ) & ( first_escape < 0 ) ) {
+						first_escape =
+						  ( first - first_first ) + find_lsb_set( tag, backslashes );
+					}
+					first += char_block_size_v<ExecTag>;
+				}
+				return last;
+			}
+
+			/***
+			 * Find the end of a block comment.  first is after the opening slash
+			 * and star.  The closing pairs of a block are the slashes that follow a
+			 * star, the star of a pair that straddles two blocks is carried to the
+			 * next one
+			 * @return The position after the closing slash, or last when there is
+			 * none
+			 */
+			template<typename ExecTag, typename CharT>
+			inline CharT *mem_skip_block_comment( ExecTag, CharT *first,
+			                                      CharT *const last ) {
+				static_assert( std::is_base_of_v<sse42_exec_tag, ExecTag> );
+				constexpr auto tag = ExecTag{ };
+				constexpr auto block_size = char_block_size_v<ExecTag>;
+				UInt32 prev_star = 0_u32;
+				while( last - first >= block_size ) {
+					auto const val0 = load_char_block( tag, first );
+					UInt32 const stars = mem_find_eq<'*'>( tag, val0 );
+					UInt32 const ends =
+					  ( ( stars << 1U ) | prev_star ) & mem_find_eq<'/'>( tag, val0 );
+					if( ends != 0 ) {
+						return first + find_lsb_set( tag, ends ) + 1;
+					}
+					prev_star = stars >> static_cast<unsigned>( block_size - 1 );
+					first += block_size;
+				}
+				if( ( prev_star != 0 ) & ( first < last ) ) {
+					if( *first == '/' ) {
+						return first + 1;
+					}
+				}
+				while( last - first >= 2 ) {
+					if( ( first[0] == '*' ) & ( first[1] == '/' ) ) {
+						return first + 2;
+					}
+					++first;
+				}
+				return last;
+			}
+
+			/***
+			 * Copy the characters of [first, last) to out up to the next of keys.
+			 * Each block is stored whole before it is searched, so out must have
+			 * room for last - first characters.  The characters stored past the
+			 * match are overwritten by the caller
+			 * @return The position of the match, or last when there is none.  out
+			 * is the position after the copied characters
+			 */
+			template<char... keys, typename ExecTag, typename CharT>
+			DAW_ATTRIB_INLINE CharT *mem_copy_to_next_of( ExecTag, CharT *first,
+			                                              CharT *const last,
+			                                              char *&out ) {
+				static_assert( std::is_base_of_v<sse42_exec_tag, ExecTag> );
+				constexpr auto tag = ExecTag{ };
+				constexpr auto block_size = char_block_size_v<ExecTag>;
+				char *it = out;
+				while( last - first >= block_size ) {
+					auto const val0 = load_char_block( tag, first );
+					store_char_block( tag, it, val0 );
+					UInt32 const found = ( mem_find_eq<keys>( tag, val0 ) | ... );
+					if( found != 0 ) {
+						auto const pos = find_lsb_set( tag, found );
+						out = it + pos;
+						return first + pos;
+					}
+					first += block_size;
+					it += block_size;
+				}
+				while( first < last and not( ( *first == keys ) | ... ) ) {
+					*it++ = *first++;
+				}
+				out = it;
+				return first;
+			}
+
+			/***
+			 * Find the next byte in a string that is not a plain character, a
+			 * quote, a backslash, a control character or, with check_high, a
+			 * byte that is not ASCII
+			 * @return The position of the byte, or last when there is none
+			 */
+			template<bool check_high, typename ExecTag, typename CharT>
+			inline CharT *mem_move_to_string_special( ExecTag, CharT *first,
+			                                          CharT *const last ) {
+				static_assert( std::is_base_of_v<sse42_exec_tag, ExecTag> );
+				constexpr auto tag = ExecTag{ };
+				constexpr auto block_size = char_block_size_v<ExecTag>;
+				while( last - first >= block_size ) {
+					auto const val0 = load_char_block( tag, first );
+					UInt32 found = mem_find_eq<'"'>( tag, val0 ) |
+					               mem_find_eq<'\\'>( tag, val0 ) |
+					               find_control_chars( tag, val0 );
+					if constexpr( check_high ) {
+						found = found | find_high_bit( tag, val0 );
+					}
+					if( found != 0 ) {
+						return first + find_lsb_set( tag, found );
+					}
+					first += block_size;
+				}
+				while( first < last ) {
+					auto const c = static_cast<unsigned char>( *first );
+					if( ( c == '"' ) | ( c == '\\' ) | ( c < 0x20U ) |
+					    ( check_high & ( c >= 0x80U ) ) ) {
+						return first;
+					}
+					++first;
+				}
+				return last;
+			}
+
+			/***
+			 * Count the elements of an array of numbers, see
+			 * count_number_array_elements.  The separators are counted a block at
+			 * a time up to the closing bracket
+			 */
+			template<typename ExecTag, typename CharT>
+			inline std::ptrdiff_t
+			mem_count_number_array_elements( ExecTag, CharT *first,
+			                                 CharT *const last ) {
+				static_assert( std::is_base_of_v<sse42_exec_tag, ExecTag> );
+				constexpr auto tag = ExecTag{ };
+				constexpr auto block_size = char_block_size_v<ExecTag>;
+				constexpr std::uint32_t block_mask =
+				  0xFFFF'FFFFU >> static_cast<unsigned>( 32 - block_size );
+				std::ptrdiff_t separators = 0;
+				while( last - first >= block_size ) {
+					auto const val0 = load_char_block( tag, first );
+					auto const closes =
+					  static_cast<std::uint32_t>( mem_find_eq<']'>( tag, val0 ) );
+					auto const commas = mem_find_eq<','>( tag, val0 );
+					auto const others = ~static_cast<std::uint32_t>(
+					                      find_number_chars( tag, val0 ) | commas |
+					                      ~find_not_whitespace( tag, val0 ) ) &
+					                    block_mask;
+					if( closes != 0 ) {
+						// Only the bytes before the closing bracket are in the array
+						auto const in_array = ( closes - 1U ) & ~closes;
+						if( ( others & in_array ) != 0 ) {
+							return -1;
 						}
-						first += 2;
+						return separators +
+						       count_set_bits( tag, commas & to_uint32( in_array ) ) + 1;
+					}
+					if( others != 0 ) {
+						return -1;
 					}
+					separators += count_set_bits( tag, commas );
+					first += block_size;
 				}
-				return ( is_unchecked_input or DAW_LIKELY( first < last ) ) ? first
-				                                                            : last;
+				return count_number_array_elements( constexpr_exec_tag{ }, first, last,
+				                                    separators );
 			}
+#endif
+			namespace cpu_dispatch {
+#if defined( DAW_JSON_HAS_CPU_DISPATCH )
+				/***
+				 * The entry points of the function tables.  The AVX2 ones are
+				 * compiled for AVX2 and flatten the width generic kernels, so the
+				 * block operations are inlined into them
+				 */
+				inline char const *skip_string_sse2( char const *first,
+				                                     char const *last,
+				                                     std::ptrdiff_t &first_escape ) {
+					return mem_skip_string_blocks<false>( sse2_block_tag{ }, first, last,
+					                                      first_escape );
+				}
 
+				inline char const *skip_whitespace_sse2( char const *first,
+				                                         char const *last ) {
+					return mem_skip_whitespace_blocks( sse2_block_tag{ }, first, last );
+				}
+
+				template<char... keys>
+				inline char const *find_any_of_sse2( char const *first,
+				                                     char const *last ) {
+					return mem_move_to_next_of_blocks<keys...>( sse2_block_tag{ }, first,
+					                                            last );
+				}
+
+				DAW_ATTRIB_FLATTEN DAW_JSON_TARGET_AVX2 inline char const *
+				skip_string_avx2( char const *first, char const *last,
+				                  std::ptrdiff_t &first_escape ) {
+					return mem_skip_string_blocks<false>( avx2_block_tag{ }, first, last,
+					                                      first_escape );
+				}
+
+				DAW_ATTRIB_FLATTEN DAW_JSON_TARGET_AVX2 inline char const *
+				skip_whitespace_avx2( char const *first, char const *last ) {
+					return mem_skip_whitespace_blocks( avx2_block_tag{ }, first, last );
+				}
+
+				template<char... keys>
+				DAW_ATTRIB_FLATTEN DAW_JSON_TARGET_AVX2 inline char const *
+				find_any_of_avx2( char const *first, char const *last ) {
+					return mem_move_to_next_of_blocks<keys...>( avx2_block_tag{ }, first,
+					                                            last );
+				}
 #endif
+
+				inline kernel_table_t make_kernel_table( isa_level lvl ) {
+					switch( lvl ) {
+#if defined( DAW_JSON_HAS_CPU_DISPATCH )
+					case isa_level::avx2:
+						return { lvl, &skip_string_avx2, &skip_whitespace_avx2 };
+					case isa_level::sse2:
+						return { lvl, &skip_string_sse2, &skip_whitespace_sse2 };
+#endif
+					default:
+						return { isa_level::scalar, &skip_string_scalar,
+						         &skip_whitespace_scalar };
+					}
+				}
+
+				/// @brief The kernels for the current CPU, resolved on first use
+				inline kernel_table_t const &kernels( ) {
+					static kernel_table_t const result =
+					  make_kernel_table( current_isa_level( ) );
+					return result;
+				}
+
+				/// @brief The character search kernel for keys..., resolved on first
+				/// use.  There is one function pointer per set of keys
+				template<char... keys>
+				inline find_any_of_fn_t find_any_of_kernel( ) {
+					static find_any_of_fn_t const result = []( ) -> find_any_of_fn_t {
+						switch( current_isa_level( ) ) {
+#if defined( DAW_JSON_HAS_CPU_DISPATCH )
+						case isa_level::avx2:
+							return &find_any_of_avx2<keys...>;
+						case isa_level::sse2:
+							return &find_any_of_sse2<keys...>;
+#endif
+						default:
+							return &find_any_of_scalar<keys...>;
+						}
+					}( );
+					return result;
+				}
+			} // namespace cpu_dispatch
+
+			/***
+			 * dispatch_exec_tag kernels.  These forward to the implementation
+			 * resolved for the current CPU in cpu_dispatch::kernels( ).  They are
+			 * bounds checked, so are used for both checked and unchecked input
+			 */
+			template<bool is_unchecked_input, char... keys, typename CharT>
+			DAW_ATTRIB_INLINE CharT *
+			mem_move_to_next_of( dispatch_exec_tag, CharT *first, CharT *last ) {
+				char const *const ptr =
+				  cpu_dispatch::find_any_of_kernel<keys...>( )( first, last );
+				return first + ( ptr - first );
+			}
+
+			template<bool is_unchecked_input, typename CharT>
+			DAW_ATTRIB_INLINE CharT *
+			mem_skip_until_end_of_string( dispatch_exec_tag, CharT *first,
+			                              CharT *const last,
+			                              std::ptrdiff_t &first_escape ) {
+				char const *const ptr =
+				  cpu_dispatch::kernels( ).skip_string( first, last, first_escape );
+				return first + ( ptr - first );
+			}
+
+			template<bool is_unchecked_input, typename CharT>
+			DAW_ATTRIB_INLINE CharT *
+			mem_skip_until_end_of_string( dispatch_exec_tag tag, CharT *first,
+			                              CharT *const last ) {
+				// A non-negative value tells the kernel not to look for escapes
+				std::ptrdiff_t first_escape = 0;
+				return mem_skip_until_end_of_string<is_unchecked_input>(
+				  tag, first, last, first_escape );
+			}
+
+			template<typename CharT>
+			DAW_ATTRIB_INLINE CharT *
+			mem_skip_whitespace( dispatch_exec_tag, CharT *first, CharT *last ) {
+				char const *const ptr =
+				  cpu_dispatch::kernels( ).skip_whitespace( first, last );
+				return first + ( ptr - first );
+			}
+
 			template<bool is_unchecked_input, char... keys, typename CharT>
 			DAW_ATTRIB_INLINE CharT *
 			mem_move_to_next_of( runtime_exec_tag, CharT *first, CharT *last ) {
@@ -401,7 +1170,7 @@ namespace daw::json {
 						if constexpr( is_unchecked_input ) {
 							++first;
 						} else {
-							first += static_cast<int>( static_cast<bool>( last - first ) );
+							first += static_cast<int>( last - first > 1 );
 						}
 						break;
 					}
@@ -429,12 +1198,12 @@ namespace daw::json {
 						return first;
 					case '\\':
 						if( first_escape < 0 ) {
-							first_escape = first_first - first;
+							first_escape = first - first_first;
 						}
 						if constexpr( is_unchecked_input ) {
 							++first;
 						} else {
-							first += static_cast<int>( static_cast<bool>( last - first ) );
+							first += static_cast<int>( last - first > 1 );
 						}
 						break;
 					}
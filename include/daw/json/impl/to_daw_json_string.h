@@ -30,6 +30,7 @@
 
 #include <array>
 #include <ciso646>
+#include <cstdint>
 #include <daw/third_party/dragonbox/dragonbox.h>
 #include <optional>
 #include <sstream>
@@ -735,8 +736,7 @@ namespace daw::json {
 
 			template<typename JsonMember, typename WriteableType, typename parse_to_t>
 			[[nodiscard]] constexpr WriteableType
-			to_daw_json_string( ParseTag<JsonParseTypes::Signed>, WriteableType it,
-			                    parse_to_t const &value ) {
+			signed_to_string( WriteableType it, parse_to_t const &value ) {
 
 				static_assert(
 				  std::is_convertible_v<parse_to_t, typename JsonMember::base_type>,
@@ -809,6 +809,63 @@ namespace daw::json {
 				}
 			}
 
+			/***
+			 * Write an integer scaled by 10^JsonMember::fixed_point_scale as a
+			 * decimal number with fixed_point_scale decimal places
+			 */
+			template<typename JsonMember, typename WriteableType, typename parse_to_t>
+			[[nodiscard]] constexpr WriteableType
+			fixed_point_to_string( WriteableType it, parse_to_t const &value ) {
+				static_assert(
+				  std::is_convertible_v<parse_to_t, typename JsonMember::base_type>,
+				  "value must be convertible to specified type in class contract" );
+
+				auto const v = static_cast<std::int64_t>(
+				  static_cast<typename JsonMember::base_type>( value ) );
+				// The magnitude of daw::numeric_limits<std::int64_t>::min( ) fits
+				auto mag = v < 0 ? 0U - static_cast<std::uint64_t>( v )
+				                 : static_cast<std::uint64_t>( v );
+				// sign, 19 digits, decimal point and quotes
+				char buff[daw::numeric_limits<std::uint64_t>::digits10 + 5]{ };
+				char *const last = buff + std::size( buff );
+				char *ptr = last;
+				if constexpr( JsonMember::literal_as_string ==
+				              options::LiteralAsStringOpt::Always ) {
+					*--ptr = '"';
+				}
+				if constexpr( JsonMember::fixed_point_scale > 0 ) {
+					for( std::size_t n = 0; n < JsonMember::fixed_point_scale; ++n ) {
+						*--ptr = static_cast<char>( '0' + static_cast<char>( mag % 10U ) );
+						mag /= 10U;
+					}
+					*--ptr = '.';
+				}
+				do {
+					*--ptr = static_cast<char>( '0' + static_cast<char>( mag % 10U ) );
+					mag /= 10U;
+				} while( mag != 0 );
+				if( v < 0 ) {
+					*--ptr = '-';
+				}
+				if constexpr( JsonMember::literal_as_string ==
+				              options::LiteralAsStringOpt::Always ) {
+					*--ptr = '"';
+				}
+				it.copy_buffer( ptr, last );
+				return it;
+			}
+
+			template<typename JsonMember, typename WriteableType, typename parse_to_t>
+			[[nodiscard]] constexpr WriteableType
+			to_daw_json_string( ParseTag<JsonParseTypes::Signed>, WriteableType it,
+			                    parse_to_t const &value ) {
+				if constexpr( is_fixed_point_v<JsonMember> ) {
+					return fixed_point_to_string<JsonMember>( DAW_MOVE( it ), value );
+				} else {
+					return signed_to_string<JsonMember>( DAW_MOVE( it ), value );
+				}
+			}
+
 			template<typename JsonMember, typename WriteableType, typename parse_to_t>
 			[[nodiscard]] constexpr WriteableType
 			to_daw_json_string( ParseTag<JsonParseTypes::Unsigned>, WriteableType it,
@@ -1363,6 +1420,40 @@ namespace daw::json {
 			inline static constexpr std::size_t find_names_in_pack_v =
 			  find_names_in_pack<Needle, Haystack...>::value;
 
+			/***
+			 * The comma and name of a class member as they are serialized,
+			 * ,"name":, with a space after the colon when not minified.  These are
+			 * written with one write by serialization_policy::write_member_name
+			 */
+			template<typename JsonMember, options::SerializationFormat Format>
+			inline constexpr auto member_name_literal = [] {
+				constexpr bool has_space =
+				  Format != options::SerializationFormat::Minified;
+				constexpr auto name = daw::string_view(
+				  std::data( JsonMember::name ), std::size( JsonMember::name ) );
+				std::array<char, std::size( name ) + ( has_space ? 5U : 4U )> result{ };
+				std::size_t pos = 0;
+				result[pos++] = ',';
+				result[pos++] = '"';
+				for( std::size_t n = 0; n < std::size( name ); ++n ) {
+					result[pos++] = name[n];
+				}
+				result[pos++] = '"';
+				result[pos++] = ':';
+				if constexpr( has_space ) {
+					result[pos++] = ' ';
+				}
+				return result;
+			}( );
+
+			template<typename JsonMember, typename SerializationPolicy>
+			inline constexpr daw::string_view member_name_literal_v = [] {
+				constexpr auto const &chars =
+				  member_name_literal<JsonMember,
+				                      SerializationPolicy::serialization_format>;
+				return daw::string_view( std::data( chars ), std::size( chars ) );
+			}( );
+
 			template<std::size_t, typename JsonMember, typename /*NamePack*/,
 			         typename WriteableType, typename TpArgs, typename Value,
 			         typename VisitedMembers,
@@ -1410,15 +1501,11 @@ namespace daw::json {
 					return;
 				}
 				visited_members.push_back( dependent_member::name );
-				if( not is_first ) {
-					it.put( ',' );
-				}
-				it.next_member( );
+				using policy_t =
+				  serialization_policy<WriteableType, SerializationOptions>;
+				it.write_member_name( member_name_literal_v<dependent_member, policy_t>,
+				                      is_first );
 				is_first = false;
-				it.put( '"' );
-				it = utils::copy_to_iterator<false, options::EightBitModes::AllowFull>(
-				  it, dependent_member::name );
-				it.write( "\":", it.space );
 
 				if constexpr( has_switcher_v<base_member_t> ) {
 					it = member_to_string( template_arg<dependent_member>, it,
@@ -1452,15 +1539,11 @@ namespace daw::json {
 						return;
 					}
 				}
-				if( not is_first ) {
-					it.put( ',' );
-				}
-				it.next_member( );
+				using policy_t =
+				  serialization_policy<WriteableType, SerializationOptions>;
+				it.write_member_name( member_name_literal_v<JsonMember, policy_t>,
+				                      is_first );
 				is_first = false;
-				it.put( '"' );
-				it = utils::copy_to_iterator<false, options::EightBitModes::AllowFull>(
-				  it, JsonMember::name );
-				it.write( "\":", it.space );
 				it = member_to_string( template_arg<JsonMember>, DAW_MOVE( it ),
 				                       get<pos>( tp ) );
 			}
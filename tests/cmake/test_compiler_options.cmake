@@ -2,8 +2,14 @@
 option( DAW_JSON_USE_SANITIZERS "Enable address and undefined sanitizers" OFF )
 option( DAW_WERROR "Enable WError for test builds" OFF )
 option( DAW_ALLOW_SSE42 "EXPERIMENTAL: Enable WError for test builds" OFF )
+option( DAW_ALLOW_AVX2 "EXPERIMENTAL: Enable the AVX2 exec mode for test builds, implies DAW_ALLOW_SSE42" OFF )
 option( DAW_JSON_COVERAGE "Enable code coverage(gcc/clang)" OFF )
 
+if( DAW_ALLOW_AVX2 )
+    set( DAW_ALLOW_SSE42 ON )
+    add_compile_definitions( DAW_ALLOW_AVX2 )
+endif()
+
 if( DAW_ALLOW_SSE42 )
     add_compile_definitions( DAW_ALLOW_SSE42 )
 endif()
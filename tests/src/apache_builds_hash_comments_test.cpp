@@ -126,6 +126,13 @@ int main( int argc, char **argv )
 		test<options::PolicyCommentTypes::hash, options::ExecModeTypes::simd>(
 		  json_sv1 );
 	}
+	if constexpr( not std::is_same_v<daw::json::avx2_exec_tag,
+	                                 daw::json::simd_exec_tag> ) {
+		std::cout << "Using " << daw::json::avx2_exec_tag::name
+		          << " exec model\n*********************************************\n";
+		test<options::PolicyCommentTypes::hash, options::ExecModeTypes::avx2>(
+		  json_sv1 );
+	}
 }
 #ifdef DAW_USE_EXCEPTIONS
 catch( daw::json::json_exception const &jex ) {
@@ -96,6 +96,10 @@ int main( int argc, char **argv )
 	                                 daw::json::runtime_exec_tag> ) {
 		test<ExecModeTypes::simd>( json_sv1 );
 	}
+	if constexpr( not std::is_same_v<daw::json::avx2_exec_tag,
+	                                 daw::json::simd_exec_tag> ) {
+		test<ExecModeTypes::avx2>( json_sv1 );
+	}
 
 	std::cout
 	  << "to_json testing\n*********************************************\n";
@@ -0,0 +1,94 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  The comment policies skip whitespace and comments a block at a time in the
+//  SIMD exec modes.  Check comments that end on and across the 16 and 32 byte
+//  block boundaries against the compile_time exec mode
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct commented_t {
+	int a;
+	std::vector<int> b;
+
+	bool operator==( commented_t const &rhs ) const {
+		return a == rhs.a and b == rhs.b;
+	}
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<commented_t> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		using type =
+		  json_member_list<json_link<a, int>, json_link<b, std::vector<int>>>;
+	};
+} // namespace daw::json
+
+using namespace daw::json;
+
+template<options::PolicyCommentTypes Comments, options::ExecModeTypes ExecMode>
+void test_doc( std::string_view doc ) {
+	auto const expected = from_json<commented_t>(
+	  doc, options::parse_flags<Comments, options::ExecModeTypes::compile_time> );
+	auto const checked =
+	  from_json<commented_t>( doc, options::parse_flags<Comments, ExecMode> );
+	test_assert( checked == expected, "Expected the same result checked" );
+	auto const unchecked = from_json<commented_t>(
+	  doc,
+	  options::parse_flags<Comments, ExecMode, options::CheckedParseMode::no> );
+	test_assert( unchecked == expected, "Expected the same result unchecked" );
+}
+
+template<options::ExecModeTypes ExecMode>
+void test_mode( ) {
+	for( std::size_t pad = 0; pad < 40; ++pad ) {
+		auto const p = std::string( pad, ' ' );
+		auto const stars = std::string( pad, '*' );
+		test_doc<options::PolicyCommentTypes::cpp, ExecMode>(
+		  "{" + p + "/*" + p + "*/\"a\":/**" + stars + "/1, // " + p +
+		  "\n\"b\" /* / * */ : [ 1, /*" + stars + "*" + p + "**/ 2 //" + p +
+		  "\n ] }" );
+		test_doc<options::PolicyCommentTypes::hash, ExecMode>(
+		  "{" + p + "# " + p + "\n \"a\":#" + stars + "\n1," + p + "#\n#\n" +
+		  "\"b\"# x\n: [ 1, #" + p + "\n 2" + p + "# ]\n] }" );
+	}
+}
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_mode<options::ExecModeTypes::runtime>( );
+	test_mode<options::ExecModeTypes::simd>( );
+	test_mode<options::ExecModeTypes::avx2>( );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,162 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  Compares the dispatch exec mode, which selects its kernels from cpuid at
+//  runtime, with the compile time selected modes.  The small document
+//  benchmark shows the per document cost of going through the function table
+//
+
+#include "defines.h"
+
+#include "citm_test_json.h"
+#include "daw_json_benchmark.h"
+#include "twitter_test_json.h"
+
+#include <daw/daw_read_file.h>
+#include <daw/json/daw_json_link.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 250;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+struct small_doc_t {
+	std::int64_t id;
+	std::string_view lang;
+	std::string_view text;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<small_doc_t> {
+		static constexpr char const id[] = "id";
+		static constexpr char const lang[] = "lang";
+		static constexpr char const text[] = "text";
+		using type = json_member_list<json_link<id, std::int64_t>,
+		                              json_link<lang, std::string_view>,
+		                              json_link<text, std::string_view>>;
+	};
+} // namespace daw::json
+
+using namespace daw::json;
+
+template<options::ExecModeTypes ExecMode>
+void test( std::string_view twitter_doc, std::string_view citm_doc,
+           std::vector<std::string> const &small_docs ) {
+	std::cout << "Using " << to_string( ExecMode )
+	          << " exec model\n*********************************************\n";
+	{
+		auto ret = daw::json::benchmark::benchmark(
+		  DAW_NUM_RUNS, twitter_doc.size( ), "twitter bench",
+		  []( auto const &sv ) {
+			  return from_json<daw::twitter::twitter_object_t>(
+			    sv, options::parse_flags<ExecMode> );
+		  },
+		  twitter_doc );
+		test_assert( ret.has_value( ), "Expected a value" );
+		test_assert( not ret.get( ).statuses.empty( ),
+		             "Expected values: twitter_result is empty" );
+	}
+	{
+		auto ret = daw::json::benchmark::benchmark(
+		  DAW_NUM_RUNS, citm_doc.size( ), "citm bench",
+		  []( auto const &sv ) {
+			  return from_json<daw::citm::citm_object_t>(
+			    sv, options::parse_flags<ExecMode> );
+		  },
+		  citm_doc );
+		test_assert( ret.has_value( ), "Expected a value" );
+		test_assert( not ret.get( ).areaNames.empty( ), "Expected values" );
+	}
+	{
+		std::size_t total_size = 0;
+		for( auto const &doc : small_docs ) {
+			total_size += doc.size( );
+		}
+		auto const start = std::chrono::steady_clock::now( );
+		auto ret = daw::json::benchmark::benchmark(
+		  DAW_NUM_RUNS, total_size, "small documents bench",
+		  []( auto const &docs ) {
+			  std::size_t result = 0;
+			  for( auto const &doc : docs ) {
+				  auto const v =
+				    from_json<small_doc_t>( doc, options::parse_flags<ExecMode> );
+				  result += v.text.size( );
+			  }
+			  return result;
+		  },
+		  small_docs );
+		auto const elapsed = std::chrono::steady_clock::now( ) - start;
+		test_assert( ret.has_value( ), "Expected a value" );
+		auto const doc_count = small_docs.size( ) * ( DAW_NUM_RUNS + 1U );
+		std::cout << "  per document: "
+		          << daw::json::benchmark::ns_to_string(
+		               elapsed / static_cast<long long>( doc_count ), 1 )
+		          << '\n';
+	}
+}
+
+int main( int argc, char **argv )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	if( argc < 3 ) {
+		std::cerr << "Must supply a path to twitter.json and citm_catalog.json\n";
+		exit( 1 );
+	}
+	auto const twitter_doc = *daw::read_file( argv[1] );
+	auto const citm_doc = *daw::read_file( argv[2] );
+	test_assert( twitter_doc.size( ) > 2, "Minimum json data size is 2 '{}'" );
+	test_assert( citm_doc.size( ) > 2, "Minimum json data size is 2 '{}'" );
+
+	auto small_docs = std::vector<std::string>( );
+	for( std::size_t n = 0; n < 10'000; ++n ) {
+		small_docs.push_back(
+		  R"({"id": )" + std::to_string( n ) +
+		  R"(, "lang": "en", "text": "RT @user: a short message \"quoted\" )" +
+		  std::to_string( n * 7U ) + R"("})" );
+	}
+
+	std::cout << "Dispatch selected the "
+	          << json_details::cpu_dispatch::to_string(
+	               json_details::cpu_dispatch::current_isa_level( ) )
+	          << " kernels\n";
+
+	test<options::ExecModeTypes::runtime>( twitter_doc, citm_doc, small_docs );
+	test<options::ExecModeTypes::dispatch>( twitter_doc, citm_doc, small_docs );
+	if constexpr( not std::is_same_v<simd_exec_tag, runtime_exec_tag> ) {
+		test<options::ExecModeTypes::simd>( twitter_doc, citm_doc, small_docs );
+	}
+	if constexpr( not std::is_same_v<avx2_exec_tag, simd_exec_tag> ) {
+		test<options::ExecModeTypes::avx2>( twitter_doc, citm_doc, small_docs );
+	}
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
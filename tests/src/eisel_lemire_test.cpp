@@ -0,0 +1,186 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  With options::IEEE754Precise, numbers outside of the exact power10 range
+//  are converted with Eisel-Lemire.  Check that the double and float results
+//  are the same as strtod and strtof
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_bit_cast.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+using namespace daw::json;
+
+constexpr std::string_view edge_cases[] = {
+  "1e23",
+  "9007199254740993",
+  "9007199254740995",
+  "-9007199254740993e10",
+  "2.2250738585072011e-308",
+  "2.2250738585072014e-308",
+  "4.9406564584124654e-324",
+  "2.4703282292062328e-324",
+  "2.4703282292062327e-324",
+  "1e-400",
+  "-1e-400",
+  "1.7976931348623157e308",
+  "1.7976931348623158e308",
+  "1.7976931348623159e308",
+  "1e309",
+  "-1e309",
+  "0e400",
+  "0.0000000000000000000000000000001",
+  "123456789012345678e-40",
+  "7.2057594037927933e16",
+  "-65.613616999999977",
+  "0.30000000000000004",
+  "1.00000000000000011102230246251565404236316680908203125",
+  "1.00000000000000011102230246251565404236316680908203124",
+  "16777217",
+  "3.4028235e38",
+  "3.4028236e38",
+  "1.17549435e-38",
+  "1.4e-45",
+  "7.0064923e-46",
+  "1e-46",
+  "1234567890123456789" };
+
+template<typename Real>
+Real strto( std::string const &number ) {
+	if constexpr( std::is_same_v<Real, float> ) {
+		return std::strtof( number.c_str( ), nullptr );
+	} else {
+		return std::strtod( number.c_str( ), nullptr );
+	}
+}
+
+template<typename Real>
+bool is_same_value( Real lhs, Real rhs ) {
+	using bits_t =
+	  std::conditional_t<sizeof( Real ) == 4, std::uint32_t, std::uint64_t>;
+	return daw::bit_cast<bits_t>( lhs ) == daw::bit_cast<bits_t>( rhs );
+}
+
+template<typename Real, options::ExecModeTypes ExecMode>
+bool same_as_strtod( std::string const &number ) {
+	auto const expected = strto<Real>( number );
+	auto const result = from_json<Real>(
+	  number, options::parse_flags<ExecMode, options::IEEE754Precise::yes> );
+	if( is_same_value( result, expected ) ) {
+		return true;
+	}
+	auto const old_precision = std::cerr.precision( );
+	std::cerr.precision( std::numeric_limits<Real>::max_digits10 );
+	std::cerr << "Mismatch parsing " << number << ": got " << result
+	          << " expected " << expected << '\n';
+	std::cerr.precision( old_precision );
+	return false;
+}
+
+template<typename Real, options::ExecModeTypes ExecMode>
+void test_mode( std::vector<std::string> const &numbers ) {
+	for( auto n : edge_cases ) {
+		test_assert( same_as_strtod<Real, ExecMode>( std::string( n ) ),
+		             "Expected the same result as strtod" );
+	}
+	for( auto const &n : numbers ) {
+		test_assert( same_as_strtod<Real, ExecMode>( n ),
+		             "Expected the same result as strtod" );
+	}
+	auto ary_doc = std::string( "[" );
+	for( auto const &n : numbers ) {
+		ary_doc += n;
+		ary_doc += ',';
+	}
+	ary_doc.back( ) = ']';
+	auto const ary = from_json_array<Real>(
+	  ary_doc, options::parse_flags<ExecMode, options::IEEE754Precise::yes> );
+	test_assert( ary.size( ) == numbers.size( ), "Expected all the numbers" );
+	for( std::size_t i = 0; i < ary.size( ); ++i ) {
+		test_assert( is_same_value( ary[i], strto<Real>( numbers[i] ) ),
+		             "Expected the same array element as strtod" );
+	}
+}
+
+std::vector<std::string> make_numbers( std::size_t count ) {
+	auto rng = std::mt19937_64( 1234 );
+	auto result = std::vector<std::string>( );
+	result.reserve( count );
+	for( std::size_t n = 0; n < count; ++n ) {
+		std::string number;
+		if( n % 2 == 0 ) {
+			// Shortest round trip strings of random doubles
+			auto d = daw::bit_cast<double>( rng( ) );
+			while( not std::isfinite( d ) ) {
+				d = daw::bit_cast<double>( rng( ) );
+			}
+			char buff[32];
+			std::snprintf( buff, sizeof( buff ), "%.17g", d );
+			number = buff;
+		} else {
+			// Up to 17 significant digits and a decimal exponent
+			auto const digits = static_cast<int>( rng( ) % 17U ) + 1;
+			auto sig = std::string( );
+			sig += static_cast<char>( '1' + rng( ) % 9U );
+			for( int d = 1; d < digits; ++d ) {
+				sig += static_cast<char>( '0' + rng( ) % 10U );
+			}
+			auto const point = rng( ) % static_cast<unsigned>( digits + 1 );
+			if( point > 0 and point < sig.size( ) ) {
+				sig.insert( point, 1, '.' );
+			}
+			auto const exp = static_cast<int>( rng( ) % 700U ) - 350;
+			number = ( rng( ) % 2U == 0 ? "-" : "" ) + sig + "e" +
+			         std::to_string( exp );
+		}
+		result.push_back( std::move( number ) );
+	}
+	return result;
+}
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	auto const numbers = make_numbers( 100'000 );
+	test_mode<double, options::ExecModeTypes::compile_time>( numbers );
+	test_mode<double, options::ExecModeTypes::runtime>( numbers );
+	test_mode<double, options::ExecModeTypes::simd>( numbers );
+	test_mode<float, options::ExecModeTypes::compile_time>( numbers );
+	test_mode<float, options::ExecModeTypes::runtime>( numbers );
+	test_mode<float, options::ExecModeTypes::simd>( numbers );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
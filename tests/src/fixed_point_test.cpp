@@ -0,0 +1,168 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  json_fixed_point members are parsed to, and serialized from, an integer
+//  scaled by 10^Scale without using floating point
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+struct quote_t {
+	std::string symbol;
+	std::int64_t price;
+	std::optional<std::int64_t> bid;
+	std::int32_t rate;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<quote_t> {
+		static constexpr char const symbol[] = "symbol";
+		static constexpr char const price[] = "price";
+		static constexpr char const bid[] = "bid";
+		static constexpr char const rate[] = "rate";
+		static constexpr auto rate_opts =
+		  options::number_opt( options::LiteralAsStringOpt::Always );
+		using type =
+		  json_member_list<json_string<symbol>, json_fixed_point<price, 4>,
+		                   json_fixed_point_null<bid, 4>,
+		                   json_fixed_point<rate, 2, std::int32_t, rate_opts>>;
+
+		static inline auto to_json_data( quote_t const &value ) {
+			return std::forward_as_tuple( value.symbol, value.price, value.bid,
+			                              value.rate );
+		}
+	};
+} // namespace daw::json
+
+using namespace daw::json;
+
+template<std::size_t Scale, typename T = std::int64_t>
+T parse( std::string_view number ) {
+	return from_json<json_fixed_point_no_name<Scale, T>>( number );
+}
+
+template<std::size_t Scale, typename T = std::int64_t>
+bool is_error( std::string_view number ) {
+#ifdef DAW_USE_EXCEPTIONS
+	try {
+		(void)parse<Scale, T>( number );
+	} catch( json_exception const & ) {
+		return true;
+	}
+	return false;
+#else
+	(void)number;
+	return true;
+#endif
+}
+
+template<options::ExecModeTypes ExecMode>
+void test_mode( ) {
+	auto const q = from_json<quote_t>(
+	  R"({"symbol":"ACME","price":123.4567,"bid":1.5e2,"rate":"-0.05"})",
+	  options::parse_flags<ExecMode> );
+	test_assert( q.symbol == "ACME" and q.price == 1234567 and
+	               q.bid == 1500000 and q.rate == -5,
+	             "Expected the scaled values" );
+
+	auto const no_bid = from_json<quote_t>(
+	  R"({"symbol":"ACME","price":-0.0001,"rate":"12"})",
+	  options::parse_flags<ExecMode> );
+	test_assert( no_bid.price == -1 and not no_bid.bid and no_bid.rate == 1200,
+	             "Expected the scaled values" );
+
+	// Arrays of fixed point values, as std::vector, are parsed in bulk
+	auto const prices = from_json_array<json_fixed_point_no_name<2>>(
+	  "[1, 2.5, 3.25, -0.01, 1e-2]", options::parse_flags<ExecMode> );
+	test_assert( prices == std::vector<std::int64_t>{ 100, 250, 325, -1, 1 },
+	             "Expected the scaled array" );
+
+	auto rng = std::mt19937_64( 42 );
+	auto values = std::vector<std::int64_t>( );
+	for( std::size_t n = 0; n < 10'000; ++n ) {
+		auto v = static_cast<std::int64_t>( rng( ) );
+		values.push_back( v >> ( rng( ) % 64U ) );
+	}
+	auto const json_values = to_json_array<json_fixed_point_no_name<6>>( values );
+	auto const parsed_values = from_json_array<json_fixed_point_no_name<6>>(
+	  json_values, options::parse_flags<ExecMode> );
+	test_assert( parsed_values == values, "Expected the values to round trip" );
+}
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_assert( parse<4>( "123.4567" ) == 1234567, "Expected 1234567" );
+	test_assert( parse<4>( "123" ) == 1230000, "Expected 1230000" );
+	test_assert( parse<4>( "123.45670000000000000000" ) == 1234567,
+	             "Expected trailing zeros to be ignored" );
+	test_assert( parse<4>( "1234567e-4" ) == 1234567, "Expected 1234567" );
+	test_assert( parse<4>( "0.000000000000000000000" ) == 0, "Expected 0" );
+	test_assert( parse<0>( "-9223372036854775808" ) == INT64_MIN,
+	             "Expected the minimum" );
+	test_assert( parse<4>( "922337203685477.5807" ) == INT64_MAX,
+	             "Expected the maximum" );
+	test_assert( parse<2, std::int32_t>( "-21474836.48" ) == INT32_MIN,
+	             "Expected the minimum" );
+	test_assert( parse<18>( "0.123456789012345678" ) == 123456789012345678,
+	             "Expected all of the digits" );
+
+	test_assert( is_error<4>( "123.45678" ), "Expected too many decimal places" );
+	test_assert( is_error<4>( "1e-5" ), "Expected too many decimal places" );
+	test_assert( is_error<4>( "1e30" ), "Expected out of range" );
+	test_assert( is_error<0>( "9223372036854775808" ), "Expected out of range" );
+	test_assert( is_error<2, std::int32_t>( "21474836.48" ),
+	             "Expected out of range" );
+	test_assert( is_error<4>( "1." ), "Expected an invalid number" );
+	test_assert( is_error<4>( "1e" ), "Expected an invalid number" );
+
+	auto const q = quote_t{ "ACME", 1234567, 1, -5 };
+	auto const json_q = to_json( q );
+	test_assert(
+	  json_q ==
+	    R"({"symbol":"ACME","price":123.4567,"bid":0.0001,"rate":"-0.05"})",
+	  "Expected the decimal point to be inserted" );
+	test_assert( to_json<json_fixed_point_no_name<4>>( INT64_MIN ) ==
+	               "-922337203685477.5808",
+	             "Expected the minimum" );
+	test_assert( to_json<json_fixed_point_no_name<0>>( std::int64_t{ 42 } ) ==
+	               "42",
+	             "Expected no decimal point" );
+
+	test_mode<options::ExecModeTypes::compile_time>( );
+	test_mode<options::ExecModeTypes::runtime>( );
+	test_mode<options::ExecModeTypes::simd>( );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,119 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  Compares a checked parse of untrusted input with validate_json alone and
+//  with from_json_validated, a validation pass followed by an unchecked parse
+//
+
+#include "defines.h"
+
+#include "citm_test_json.h"
+#include "daw_json_benchmark.h"
+#include "twitter_test_json.h"
+
+#include <daw/daw_read_file.h>
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_validate.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 250;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+using namespace daw::json;
+
+template<typename T, options::ExecModeTypes ExecMode>
+void test_doc( std::string_view name, std::string_view doc ) {
+	auto const checked = daw::json::benchmark::benchmark(
+	  DAW_NUM_RUNS, doc.size( ), std::string( name ) + " checked",
+	  []( auto const &sv ) {
+		  return from_json<T>( sv, options::parse_flags<ExecMode> );
+	  },
+	  doc );
+	test_assert( checked.has_value( ), "Expected a value" );
+
+	auto const valid = daw::json::benchmark::benchmark(
+	  DAW_NUM_RUNS, doc.size( ), std::string( name ) + " validate_json",
+	  []( auto const &sv ) {
+		  return static_cast<bool>(
+		    validate_json( sv, options::parse_flags<ExecMode> ) );
+	  },
+	  doc );
+	test_assert( valid.has_value( ) and valid.get( ),
+	             "Expected a valid document" );
+
+	auto const valid_utf8 = daw::json::benchmark::benchmark(
+	  DAW_NUM_RUNS, doc.size( ), std::string( name ) + " validate_json utf8",
+	  []( auto const &sv ) {
+		  return static_cast<bool>(
+		    validate_json( sv, options::parse_flags<ExecMode>, true ) );
+	  },
+	  doc );
+	test_assert( valid_utf8.has_value( ) and valid_utf8.get( ),
+	             "Expected a valid document" );
+
+	auto const validated = daw::json::benchmark::benchmark(
+	  DAW_NUM_RUNS, doc.size( ), std::string( name ) + " from_json_validated",
+	  []( auto const &sv ) {
+		  return from_json_validated<T>( sv, options::parse_flags<ExecMode> );
+	  },
+	  doc );
+	test_assert( validated.has_value( ), "Expected a value" );
+}
+
+template<options::ExecModeTypes ExecMode>
+void test_mode( std::string_view twitter_doc, std::string_view citm_doc ) {
+	std::cout << "Using " << to_string( ExecMode )
+	          << " exec model\n*********************************************\n";
+	test_doc<daw::twitter::twitter_object_t, ExecMode>( "twitter", twitter_doc );
+	test_doc<daw::citm::citm_object_t, ExecMode>( "citm", citm_doc );
+}
+
+int main( int argc, char **argv )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	if( argc < 3 ) {
+		std::cerr << "Must supply a path to twitter.json and citm_catalog.json\n";
+		exit( 1 );
+	}
+	auto const twitter_doc = *daw::read_file( argv[1] );
+	auto const citm_doc = *daw::read_file( argv[2] );
+	test_assert( twitter_doc.size( ) > 2, "Minimum json data size is 2 '{}'" );
+	test_assert( citm_doc.size( ) > 2, "Minimum json data size is 2 '{}'" );
+
+	test_mode<options::ExecModeTypes::runtime>( twitter_doc, citm_doc );
+	if constexpr( not std::is_same_v<simd_exec_tag, runtime_exec_tag> ) {
+		test_mode<options::ExecModeTypes::simd>( twitter_doc, citm_doc );
+	}
+	if constexpr( not std::is_same_v<avx2_exec_tag, simd_exec_tag> ) {
+		test_mode<options::ExecModeTypes::avx2>( twitter_doc, citm_doc );
+	}
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
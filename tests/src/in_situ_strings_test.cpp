@@ -0,0 +1,166 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  With options::InSituStrings the escapes of json_string_raw members are
+//  decoded in the document buffer.  Check that std::string_view members see
+//  the same text as std::string members parsed from an unmodified copy
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct escaped_t {
+	std::string a;
+	std::string b;
+};
+
+struct in_situ_t {
+	std::string_view a;
+	std::string_view b;
+};
+
+// The members a and later are both mapped to "a"
+struct twice_t {
+	std::string_view a;
+	std::string_view b;
+	std::string_view later;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<escaped_t> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		using type =
+		  json_member_list<json_link<a, std::string>, json_link<b, std::string>>;
+	};
+
+	template<>
+	struct json_data_contract<in_situ_t> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		using type = json_member_list<json_link<a, std::string_view>,
+		                              json_link<b, std::string_view>>;
+	};
+
+	template<>
+	struct json_data_contract<twice_t> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		using type = json_member_list<json_link<a, std::string_view>,
+		                              json_link<b, std::string_view>,
+		                              json_link<a, std::string_view>>;
+	};
+} // namespace daw::json
+
+using namespace daw::json;
+
+constexpr std::string_view escapes[] = {
+  R"(\")",          R"(\\)",
+  R"(\/)",          R"(\b)",
+  R"(\f)",          R"(\n)",
+  R"(\r)",          R"(\t)",
+  R"(\u0041)",      R"(\u00e9)",
+  R"(\u20AC)",      R"(\uD83D\uDE00)",
+  R"(\\\"\\\")",    R"(C:\\logs\\a.txt)" };
+
+template<options::ExecModeTypes ExecMode, options::CheckedParseMode Checked>
+void test_doc( std::string const &doc ) {
+	auto const expected = from_json<escaped_t>( doc );
+	auto buffer = doc;
+	auto const result = from_json<in_situ_t>(
+	  buffer,
+	  options::parse_flags<ExecMode, Checked, options::InSituStrings::yes> );
+	test_assert( result.a == expected.a and result.b == expected.b,
+	             "Expected the same result" );
+	test_assert( std::data( result.a ) >= std::data( buffer ) and
+	               daw::data_end( result.b ) <= daw::data_end( buffer ),
+	             "Expected the values to be in the buffer" );
+}
+
+template<options::ExecModeTypes ExecMode>
+void test_mode( ) {
+	for( std::size_t pad = 0; pad < 40; ++pad ) {
+		auto const p = std::string( pad, 'x' );
+		for( auto esc : escapes ) {
+			auto const e = std::string( esc );
+			auto const doc =
+			  R"({"a":")" + p + e + p + e + e + R"(","b":")" + e + p + R"("})";
+			test_doc<ExecMode, options::CheckedParseMode::yes>( doc );
+			test_doc<ExecMode, options::CheckedParseMode::no>( doc );
+		}
+	}
+	// Strings without escapes are left alone
+	auto buffer = std::string( R"({"a":"plain","b":""})" );
+	auto const original = buffer;
+	auto const v = from_json<in_situ_t>(
+	  buffer, options::parse_flags<ExecMode, options::InSituStrings::yes> );
+	test_assert( v.a == "plain" and v.b.empty( ), "Expected the plain text" );
+	test_assert( buffer == original, "Expected an unchanged buffer" );
+#ifdef DAW_USE_EXCEPTIONS
+	bool has_error = false;
+	try {
+		auto bad = std::string( R"({"a":"\u12G4","b":""})" );
+		(void)from_json<in_situ_t>(
+		  bad, options::parse_flags<ExecMode, options::InSituStrings::yes> );
+	} catch( json_exception const & ) {
+		has_error = true;
+	}
+	test_assert( has_error, "Expected an invalid unicode escape error" );
+#endif
+}
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_mode<options::ExecModeTypes::compile_time>( );
+	test_mode<options::ExecModeTypes::runtime>( );
+	test_mode<options::ExecModeTypes::simd>( );
+	test_mode<options::ExecModeTypes::avx2>( );
+	test_mode<options::ExecModeTypes::dispatch>( );
+
+	auto buffer = std::string( R"(["a\tb","\u00e9\u20ac\ud83d\ude00","c"])" );
+	auto const ary = from_json_array<std::string_view>(
+	  buffer, options::parse_flags<options::InSituStrings::yes> );
+	test_assert( ary.size( ) == 3 and ary[0] == "a\tb" and
+	               ary[1] == "\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80" and
+	               ary[2] == "c",
+	             "Expected the decoded array" );
+
+	// Each value is decoded once, by the member that it is parsed into.  Out of
+	// order members are skipped over before they are decoded
+	auto twice_buffer =
+	  std::string( R"({"b":"\"b\"","a":"\"1\"","x":"\"","a":"\"2\""})" );
+	auto const twice = from_json<twice_t>(
+	  twice_buffer, options::parse_flags<options::InSituStrings::yes> );
+	test_assert( twice.a == R"("1")" and twice.b == R"("b")" and
+	               twice.later == R"("2")",
+	             "Expected each member decoded once" );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,205 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  options::LearnMemberOrder parses members in the order of the document and
+//  remembers that order for the next document.  Check that the results match
+//  the default parser as the order changes and time both ways
+//
+
+#include "daw_json_benchmark.h"
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+struct event_t {
+	std::int64_t id;
+	std::string name;
+	std::optional<int> level;
+	std::vector<int> tags;
+	double value;
+
+	bool operator==( event_t const &rhs ) const {
+		return id == rhs.id and name == rhs.name and level == rhs.level and
+		       tags == rhs.tags and value == rhs.value;
+	}
+};
+
+// The same members, with the learn_member_order trait
+struct learned_event_t {
+	std::int64_t id;
+	std::string name;
+	std::optional<int> level;
+	std::vector<int> tags;
+	double value;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<event_t> {
+		static constexpr char const id[] = "id";
+		static constexpr char const name[] = "name";
+		static constexpr char const level[] = "level";
+		static constexpr char const tags[] = "tags";
+		static constexpr char const value[] = "value";
+		using type =
+		  json_member_list<json_link<id, std::int64_t>,
+		                   json_link<name, std::string>,
+		                   json_link<level, std::optional<int>>,
+		                   json_link<tags, std::vector<int>>, json_link<value, double>>;
+	};
+
+	template<>
+	struct json_data_contract<learned_event_t> {
+		using learn_member_order = void;
+		static constexpr char const id[] = "id";
+		static constexpr char const name[] = "name";
+		static constexpr char const level[] = "level";
+		static constexpr char const tags[] = "tags";
+		static constexpr char const value[] = "value";
+		using type =
+		  json_member_list<json_link<id, std::int64_t>,
+		                   json_link<name, std::string>,
+		                   json_link<level, std::optional<int>>,
+		                   json_link<tags, std::vector<int>>, json_link<value, double>>;
+	};
+} // namespace daw::json
+
+using namespace daw::json;
+
+inline constexpr auto learn_flags =
+  options::parse_flags<options::LearnMemberOrder::yes>;
+
+void check( std::string_view doc, char const *msg ) {
+	auto const expected = from_json<event_t>( doc );
+	// Twice, the second parse uses the order learned in the first
+	for( int n = 0; n < 2; ++n ) {
+		test_assert( from_json<event_t>( doc, learn_flags ) == expected, msg );
+	}
+}
+
+void test_documents( ) {
+	check( R"({"id":1,"name":"a","level":2,"tags":[1,2],"value":0.5})",
+	       "In order" );
+	check( R"({"value":0.5,"tags":[1,2],"level":2,"name":"a","id":1})",
+	       "Reversed" );
+	check( R"({"tags":[],"value":0.5,"id":1,"name":"a"})",
+	       "Missing nullable member" );
+	check( R"({"tags":[3],"x":{"id":5},"value":0.5,"id":1,"y":null,"name":"a"})",
+	       "Unknown members" );
+	check( R"({ "name" : "a" , "id" : 1 , "tags" : [ ] , "value" : 0.5 })",
+	       "Whitespace" );
+
+	using order_t = json_details::learned_member_order<event_t, 5>;
+	(void)from_json<event_t>(
+	  R"({"value":0.5,"tags":[1,2],"level":2,"name":"a","id":1})", learn_flags );
+	test_assert( ( order_t::get( ) == order_t::order_t{ 4, 3, 2, 1, 0 } ),
+	             "Expected to learn the reversed order" );
+	(void)from_json<event_t>( R"({"tags":[],"value":0.5,"id":1,"name":"a"})",
+	                          learn_flags );
+	test_assert( ( order_t::get( ) == order_t::order_t{ 3, 4, 0, 1, 2 } ),
+	             "Expected missing members at the end" );
+
+	auto const ev = from_json<learned_event_t>(
+	  R"({"value":0.5,"tags":[1,2],"level":2,"name":"a","id":1})" );
+	test_assert( ev.id == 1 and ev.name == "a" and ev.level == 2 and
+	               ev.tags.size( ) == 2 and ev.value == 0.5,
+	             "Expected the trait to parse" );
+
+#ifdef DAW_USE_EXCEPTIONS
+	bool has_error = false;
+	try {
+		(void)from_json<event_t>( R"({"value":0.5,"tags":[],"level":2})",
+		                          learn_flags );
+	} catch( daw::json::json_exception const & ) { has_error = true; }
+	test_assert( has_error, "Expected an error for a missing member" );
+
+	has_error = false;
+	try {
+		(void)from_json<event_t>(
+		  R"({"value":0.5,"tags":[],"id":1,"name":"a","extra":1})",
+		  options::parse_flags<options::LearnMemberOrder::yes,
+		                       options::UseExactMappingsByDefault::yes> );
+	} catch( daw::json::json_exception const & ) { has_error = true; }
+	test_assert( has_error, "Expected an error for an unknown member" );
+#endif
+}
+
+std::string make_events( std::size_t count ) {
+	auto result = std::string( "[" );
+	for( std::size_t n = 0; n < count; ++n ) {
+		if( n > 0 ) {
+			result += ',';
+		}
+		// The members are in the reverse order of the mapping
+		result += R"({"value":)" + std::to_string( static_cast<double>( n ) / 4.0 ) +
+		          R"(,"tags":[1,2,3],"level":)" + std::to_string( n % 10 ) +
+		          R"(,"name":"event )" + std::to_string( n ) + R"(","id":)" +
+		          std::to_string( n ) + "}";
+	}
+	result += "]";
+	return result;
+}
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_documents( );
+
+	auto const json_doc = make_events( 100'000 );
+	auto const expected = from_json_array<event_t>( json_doc );
+	{
+		auto result = daw::json::benchmark::benchmark(
+		  DAW_NUM_RUNS, json_doc.size( ), "mapping order",
+		  []( std::string_view sv ) {
+			  return from_json_array<event_t>( sv );
+		  },
+		  std::string_view( json_doc ) );
+		test_assert( result.has_value( ), "Expected a value" );
+	}
+	{
+		auto result = daw::json::benchmark::benchmark(
+		  DAW_NUM_RUNS, json_doc.size( ), "learned order",
+		  []( std::string_view sv ) {
+			  return from_json_array<event_t>( sv, learn_flags );
+		  },
+		  std::string_view( json_doc ) );
+		test_assert( result.has_value( ), "Expected a value" );
+		test_assert( result.get( ) == expected, "Expected the same events" );
+	}
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
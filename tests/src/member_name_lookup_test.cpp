@@ -0,0 +1,102 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  Each options::MemberNameLookup finds the same members, including when a
+//  JSON name is mapped more than once
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+struct short_names_t {
+	int a;
+	int bb;
+	std::string c;
+	int a_name_longer_than_16_bytes;
+};
+
+// The members a and later are both mapped to "a".  The nth occurrence of "a"
+// in the document is parsed into the nth member
+struct twice_t {
+	int a;
+	int b;
+	int later;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<short_names_t> {
+		static constexpr char const a[] = "a";
+		static constexpr char const bb[] = "bb";
+		static constexpr char const c[] = "c";
+		static constexpr char const longer[] = "a_name_longer_than_16_bytes";
+		using type =
+		  json_member_list<json_number<a, int>, json_number<bb, int>,
+		                   json_string<c>, json_number<longer, int>>;
+	};
+
+	template<>
+	struct json_data_contract<twice_t> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		using type = json_member_list<json_number<a, int>, json_number<b, int>,
+		                              json_number<a, int>>;
+	};
+} // namespace daw::json
+
+using namespace daw::json;
+
+template<options::MemberNameLookup Lookup>
+void test_lookup( ) {
+	constexpr auto flags = options::parse_flags<Lookup>;
+
+	auto const s = from_json<short_names_t>(
+	  R"({"a_name_longer_than_16_bytes":4,"c":"x","unknown":[],"bb":2,"a":1})",
+	  flags );
+	test_assert( s.a == 1 and s.bb == 2 and s.c == "x" and
+	               s.a_name_longer_than_16_bytes == 4,
+	             "Expected the members out of order" );
+
+	auto const in_order = from_json<twice_t>( R"({"a":1,"b":2,"a":3})", flags );
+	test_assert( in_order.a == 1 and in_order.b == 2 and in_order.later == 3,
+	             "Expected both members mapped to a" );
+
+	auto const out_of_order =
+	  from_json<twice_t>( R"({"b":2,"a":1,"a":3})", flags );
+	test_assert( out_of_order.a == 1 and out_of_order.b == 2 and
+	               out_of_order.later == 3,
+	             "Expected both members mapped to a" );
+}
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_lookup<options::MemberNameLookup::hash>( );
+	test_lookup<options::MemberNameLookup::length_prefix>( );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
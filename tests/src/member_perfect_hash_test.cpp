@@ -0,0 +1,138 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  Classes with many members find them through a compile time perfect hash of
+//  the member names.  Check the lookups in and out of order
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+struct wide_t {
+	int id;
+	int type;
+	int timestamp;
+	int source;
+	int user_id;
+	int session;
+	int a;
+	int ab;
+	int abc;
+	int abcd;
+	int abcde;
+	int the_last_member_with_a_long_name;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<wide_t> {
+		static constexpr char const id[] = "id";
+		static constexpr char const type_name[] = "type";
+		static constexpr char const timestamp[] = "timestamp";
+		static constexpr char const source[] = "source";
+		static constexpr char const user_id[] = "user_id";
+		static constexpr char const session[] = "session";
+		static constexpr char const a[] = "a";
+		static constexpr char const ab[] = "ab";
+		static constexpr char const abc[] = "abc";
+		static constexpr char const abcd[] = "abcd";
+		static constexpr char const abcde[] = "abcde";
+		static constexpr char const last[] = "the_last_member_with_a_long_name";
+		using type = json_member_list<
+		  json_link<id, int>, json_link<type_name, int>, json_link<timestamp, int>,
+		  json_link<source, int>, json_link<user_id, int>, json_link<session, int>,
+		  json_link<a, int>, json_link<ab, int>, json_link<abc, int>,
+		  json_link<abcd, int>, json_link<abcde, int>, json_link<last, int>>;
+	};
+} // namespace daw::json
+
+using namespace daw::json;
+
+bool is_expected( wide_t const &v ) {
+	return v.id == 1 and v.type == 2 and v.timestamp == 3 and v.source == 4 and
+	       v.user_id == 5 and v.session == 6 and v.a == 7 and v.ab == 8 and
+	       v.abc == 9 and v.abcd == 10 and v.abcde == 11 and
+	       v.the_last_member_with_a_long_name == 12;
+}
+
+void test_table( ) {
+	using namespace daw::json::json_details;
+	using hash_t = member_name_perfect_hash<
+	  json_link<json_data_contract<wide_t>::id, int>,
+	  json_link<json_data_contract<wide_t>::type_name, int>,
+	  json_link<json_data_contract<wide_t>::timestamp, int>,
+	  json_link<json_data_contract<wide_t>::source, int>,
+	  json_link<json_data_contract<wide_t>::user_id, int>,
+	  json_link<json_data_contract<wide_t>::session, int>,
+	  json_link<json_data_contract<wide_t>::a, int>,
+	  json_link<json_data_contract<wide_t>::ab, int>>;
+	static_assert( hash_t::table.is_valid, "Expected a perfect hash" );
+	constexpr std::string_view names[] = { "id",     "type",    "timestamp",
+	                                       "source", "user_id", "session",
+	                                       "a",      "ab" };
+	for( std::size_t n = 0; n < std::size( names ); ++n ) {
+		test_assert( hash_t::table.find( daw::name_hash<false>( names[n] ) ) == n,
+		             "Expected to find each member at its index" );
+	}
+}
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_table( );
+
+	constexpr std::string_view in_order =
+	  R"({"id":1,"type":2,"timestamp":3,"source":4,"user_id":5,"session":6,"a":7,"ab":8,"abc":9,"abcd":10,"abcde":11,"the_last_member_with_a_long_name":12})";
+	test_assert( is_expected( from_json<wide_t>( in_order ) ), "In order" );
+
+	constexpr std::string_view reversed =
+	  R"({"the_last_member_with_a_long_name":12,"abcde":11,"abcd":10,"abc":9,"ab":8,"a":7,"session":6,"user_id":5,"source":4,"timestamp":3,"type":2,"id":1})";
+	test_assert( is_expected( from_json<wide_t>( reversed ) ), "Reversed" );
+
+	constexpr std::string_view unknown_members =
+	  R"({"abcdef":0,"session":6,"b":0,"id":1,"ids":0,"type":2,"timestamp":3,"source":4,"":0,"user_id":5,"a":7,"ab":8,"abc":9,"abcd":10,"abcde":11,"the_last_member_with_a_long_name":12,"the_last_member_with_a_long_nam":0})";
+	test_assert( is_expected( from_json<wide_t>( unknown_members ) ),
+	             "Unknown members" );
+	test_assert(
+	  is_expected( from_json<wide_t>(
+	    unknown_members,
+	    options::parse_flags<options::UseExactMappingsByDefault::no,
+	                         options::CheckedParseMode::no> ) ),
+	  "Unknown members unchecked" );
+
+#ifdef DAW_USE_EXCEPTIONS
+	bool has_error = false;
+	try {
+		constexpr std::string_view missing =
+		  R"({"id":1,"type":2,"timestamp":3,"source":4,"user_id":5,"session":6,"a":7,"ab":8,"abc":9,"abcd":10,"abcde":11})";
+		(void)from_json<wide_t>( missing );
+	} catch( daw::json::json_exception const & ) { has_error = true; }
+	test_assert( has_error, "Expected an error for a missing member" );
+#endif
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,139 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  Time the member name hashes over the member names of the documents passed
+//  on the command line
+//
+
+#include "defines.h"
+
+#include "daw_json_benchmark.h"
+
+#include <daw/daw_read_file.h>
+#include <daw/json/daw_json_link.h>
+#include <daw/json/impl/daw_murmur3.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 1000;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+// Hashes made at compile time for the mappings are compared to those of the
+// document, so both must agree
+static_assert( daw::name_hash<true>( "a_long_member_name_of_33_bytes_xx" ) ==
+               daw::name_hash<false>( "a_long_member_name_of_33_bytes_xx" ) );
+static_assert( daw::name_hash<false>( "id" ) != daw::name_hash<false>( "di" ) );
+
+void collect_names( daw::json::json_value const &jv,
+                    std::vector<std::string_view> &names ) {
+	switch( jv.type( ) ) {
+	case daw::json::JsonBaseParseTypes::Class:
+		for( auto const &jp : jv ) {
+			names.push_back( *jp.name );
+			collect_names( jp.value, names );
+		}
+		break;
+	case daw::json::JsonBaseParseTypes::Array:
+		for( auto const &jp : jv ) {
+			collect_names( jp.value, names );
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+template<typename Hash>
+void test( std::string_view title, std::vector<std::string_view> const &names,
+           std::size_t total_size, Hash hash ) {
+	auto ret = daw::json::benchmark::benchmark(
+	  DAW_NUM_RUNS, total_size, title,
+	  [hash]( auto const &ns ) {
+		  std::uint32_t result = 0;
+		  for( auto const &name : ns ) {
+			  result += static_cast<std::uint32_t>( hash( name ) );
+		  }
+		  return result;
+	  },
+	  names );
+	test_assert( ret.has_value( ), "Expected a value" );
+
+	auto distinct = std::set<std::string_view>( names.begin( ), names.end( ) );
+	auto hashes = std::set<std::uint32_t>( );
+	for( auto const &name : distinct ) {
+		hashes.insert( static_cast<std::uint32_t>( hash( name ) ) );
+	}
+	std::cout << title << ": " << distinct.size( ) << " distinct names, "
+	          << ( distinct.size( ) - hashes.size( ) ) << " collisions\n";
+}
+
+int main( int argc, char **argv )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	if( argc < 2 ) {
+		std::cerr << "Must supply paths to JSON documents\n";
+		exit( 1 );
+	}
+	auto docs = std::vector<std::string>( );
+	for( int n = 1; n < argc; ++n ) {
+		docs.push_back( *daw::read_file( argv[n] ) );
+	}
+	auto names = std::vector<std::string_view>( );
+	std::size_t total_size = 0;
+	for( auto const &doc : docs ) {
+		collect_names( daw::json::json_value( doc ), names );
+	}
+	for( auto const &name : names ) {
+		total_size += name.size( );
+	}
+	test_assert( not names.empty( ), "Expected member names" );
+	std::cout << names.size( ) << " names, " << total_size << " bytes\n";
+
+	test( "fnv1a_32", names, total_size, []( daw::string_view name ) {
+		return daw::fnv1a_32<false>( name );
+	} );
+	test( "fnv1a_32 expect long", names, total_size,
+	      []( daw::string_view name ) {
+		      return daw::fnv1a_32<true>( name );
+	      } );
+	test( "name_hash", names, total_size, []( daw::string_view name ) {
+		return daw::name_hash<false>( name );
+	} );
+	test( "name_hash expect long", names, total_size,
+	      []( daw::string_view name ) {
+		      return daw::name_hash<true>( name );
+	      } );
+	test( "murmur3_32", names, total_size, []( daw::string_view name ) {
+		return daw::murmur3_32( name );
+	} );
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
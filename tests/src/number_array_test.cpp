@@ -0,0 +1,145 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  Arrays of numbers parsed into a std::vector are counted and parsed in
+//  bulk.  Check them against a std::deque, which is parsed element by element
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+struct coordinates_t {
+	std::vector<double> xs;
+	std::vector<std::int64_t> ids;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<coordinates_t> {
+		static constexpr char const xs[] = "xs";
+		static constexpr char const ids[] = "ids";
+		using type = json_member_list<json_link<xs, std::vector<double>>,
+		                              json_link<ids, std::vector<std::int64_t>>>;
+	};
+} // namespace daw::json
+
+using namespace daw::json;
+
+constexpr char const *separators[] = { ",", ", ", " ,", "\n,\t", ",\r\n  " };
+
+template<typename T>
+std::string make_array( std::size_t count, std::mt19937_64 &rng ) {
+	auto result = std::string( "[" );
+	for( std::size_t n = 0; n < count; ++n ) {
+		if( n > 0 ) {
+			result += separators[rng( ) % std::size( separators )];
+		}
+		if constexpr( std::is_floating_point_v<T> ) {
+			auto const v =
+			  static_cast<double>( static_cast<std::int64_t>( rng( ) ) ) /
+			  static_cast<double>( 1ULL << ( rng( ) % 64U ) );
+			result += std::to_string( v );
+			if( n % 3 == 0 ) {
+				result += "e" + std::to_string( static_cast<int>( rng( ) % 40U ) - 20 );
+			}
+		} else {
+			result += std::to_string( static_cast<T>( rng( ) ) );
+		}
+	}
+	result += "]";
+	return result;
+}
+
+template<typename T, options::ExecModeTypes ExecMode>
+void test_type( std::mt19937_64 &rng ) {
+	for( std::size_t count = 0; count < 100; ++count ) {
+		auto const doc = make_array<T>( count, rng );
+		auto const bulk = from_json_array<T>( doc, options::parse_flags<ExecMode> );
+		auto const each = from_json_array<T, std::deque<T>>(
+		  doc, options::parse_flags<ExecMode> );
+		test_assert( bulk.size( ) == count and
+		               std::equal( bulk.begin( ), bulk.end( ), each.begin( ) ),
+		             "Expected the same elements" );
+	}
+}
+
+template<options::ExecModeTypes ExecMode>
+void test_mode( ) {
+	auto rng = std::mt19937_64( 42 );
+	test_type<double, ExecMode>( rng );
+	test_type<float, ExecMode>( rng );
+	test_type<int, ExecMode>( rng );
+	test_type<std::int64_t, ExecMode>( rng );
+	test_type<std::uint32_t, ExecMode>( rng );
+
+	auto const empty =
+	  from_json_array<double>( "[ \n ]", options::parse_flags<ExecMode> );
+	test_assert( empty.empty( ), "Expected an empty array" );
+
+	auto const c = from_json<coordinates_t>(
+	  R"({"xs":[1.5,-2.25e2,3],"ids":[ 9007199254740993, -1 ]})",
+	  options::parse_flags<ExecMode> );
+	test_assert( c.xs == std::vector<double>{ 1.5, -225.0, 3.0 } and
+	               c.ids == std::vector<std::int64_t>{ 9007199254740993, -1 },
+	             "Expected the class members" );
+
+	// Comments are not part of a number array, these are parsed element by
+	// element
+	auto const commented = from_json_array<int>(
+	  "[1, /* two */ 2, 3]",
+	  options::parse_flags<ExecMode, options::PolicyCommentTypes::cpp> );
+	test_assert( commented == std::vector<int>{ 1, 2, 3 },
+	             "Expected the commented array" );
+#ifdef DAW_USE_EXCEPTIONS
+	for( char const *bad : { "[1,2,]", "[1 2]", "[1,,2]", "[1,2" } ) {
+		bool has_error = false;
+		try {
+			(void)from_json_array<int>( std::string( bad ),
+			                            options::parse_flags<ExecMode> );
+		} catch( json_exception const & ) {
+			has_error = true;
+		}
+		test_assert( has_error, "Expected an invalid array to be an error" );
+	}
+#endif
+}
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_mode<options::ExecModeTypes::compile_time>( );
+	test_mode<options::ExecModeTypes::runtime>( );
+	test_mode<options::ExecModeTypes::simd>( );
+	test_mode<options::ExecModeTypes::avx2>( );
+	test_mode<options::ExecModeTypes::dispatch>( );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,211 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  Documents with their members in the mapped order can be parsed without the
+//  name lookup, see options::ExpectOrderedMembers.  Check that documents out of
+//  order still parse and time both ways
+//
+
+#include "daw_json_benchmark.h"
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+struct message_t {
+	std::int64_t id;
+	std::string_view kind;
+	std::optional<int> priority;
+	double value;
+
+	bool operator==( message_t const &rhs ) const {
+		return id == rhs.id and kind == rhs.kind and priority == rhs.priority and
+		       value == rhs.value;
+	}
+};
+
+// The same members, declared to always be in order
+struct ordered_message_t {
+	std::int64_t id;
+	std::string_view kind;
+	std::optional<int> priority;
+	double value;
+
+	bool operator==( message_t const &rhs ) const {
+		return id == rhs.id and kind == rhs.kind and priority == rhs.priority and
+		       value == rhs.value;
+	}
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<message_t> {
+		static constexpr char const id[] = "id";
+		static constexpr char const kind[] = "kind";
+		static constexpr char const priority[] = "priority";
+		static constexpr char const value[] = "value";
+		using type = json_member_list<json_link<id, std::int64_t>,
+		                              json_link<kind, std::string_view>,
+		                              json_link<priority, std::optional<int>>,
+		                              json_link<value, double>>;
+
+		static constexpr auto to_json_data( message_t const &v ) {
+			return std::forward_as_tuple( v.id, v.kind, v.priority, v.value );
+		}
+	};
+
+	template<>
+	struct json_data_contract<ordered_message_t> {
+		using expect_ordered_members = void;
+		static constexpr char const id[] = "id";
+		static constexpr char const kind[] = "kind";
+		static constexpr char const priority[] = "priority";
+		static constexpr char const value[] = "value";
+		using type = json_member_list<json_link<id, std::int64_t>,
+		                              json_link<kind, std::string_view>,
+		                              json_link<priority, std::optional<int>>,
+		                              json_link<value, double>>;
+	};
+} // namespace daw::json
+
+using namespace daw::json;
+
+message_t const expected{ 42, "alert", 3, 1.5 };
+message_t const expected_no_priority{ 42, "alert", std::nullopt, 1.5 };
+
+template<typename... Options>
+void check( std::string_view doc, message_t const &expected_value,
+            char const *msg ) {
+	test_assert( from_json<message_t>( doc ) == expected_value, msg );
+	test_assert(
+	  from_json<message_t>(
+	    doc, options::parse_flags<options::ExpectOrderedMembers::yes> ) ==
+	    expected_value,
+	  msg );
+	test_assert( from_json<ordered_message_t>( doc ) == expected_value, msg );
+}
+
+void test_documents( ) {
+	check( R"({"id":42,"kind":"alert","priority":3,"value":1.5})", expected,
+	       "In order" );
+	check( R"({ "id" : 42, "kind" : "alert", "priority" : 3, "value" : 1.5 })",
+	       expected, "In order with whitespace" );
+	check( R"({"value":1.5,"priority":3,"kind":"alert","id":42})", expected,
+	       "Reversed" );
+	check( R"({"id":42,"kind":"alert","value":1.5})", expected_no_priority,
+	       "Missing nullable member" );
+	check( R"({"id":42,"other":[1,2],"kind":"alert","priority":3,"value":1.5})",
+	       expected, "Unknown member" );
+	check( R"({"id":42,"kinds":"x","kind":"alert","priority":3,"value":1.5})",
+	       expected, "Name with the expected name as a prefix" );
+	check( R"({"id":42,"priority":3,"kind":"alert","value":1.5})", expected,
+	       "Two members swapped" );
+
+	// Unchecked input skips the names that cannot be missing
+	test_assert(
+	  from_json<message_t>(
+	    R"({"id":42,"kind":"alert","priority":3,"value":1.5})",
+	    options::parse_flags<options::ExpectOrderedMembers::yes,
+	                         options::CheckedParseMode::no> ) == expected,
+	  "In order unchecked" );
+	test_assert(
+	  from_json<message_t>(
+	    R"({"id":42,"kind":"alert","value":1.5})",
+	    options::parse_flags<options::ExpectOrderedMembers::yes,
+	                         options::CheckedParseMode::no> ) ==
+	    expected_no_priority,
+	  "Missing nullable member unchecked" );
+
+#ifdef DAW_USE_EXCEPTIONS
+	bool has_error = false;
+	try {
+		(void)from_json<message_t>(
+		  R"({"id":42,"priority":3,"value":1.5})",
+		  options::parse_flags<options::ExpectOrderedMembers::yes> );
+	} catch( daw::json::json_exception const & ) { has_error = true; }
+	test_assert( has_error, "Expected an error for a missing member" );
+#endif
+}
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_documents( );
+
+	auto messages = std::vector<message_t>( );
+	for( std::int64_t n = 0; n < 100'000; ++n ) {
+		messages.push_back( message_t{
+		  n, n % 3 == 0 ? "alert" : "status",
+		  n % 5 == 0 ? std::optional<int>{ } : std::optional<int>( n % 7 ),
+		  static_cast<double>( n ) / 4.0 } );
+	}
+	auto const json_doc = to_json_array( messages );
+	{
+		auto result = daw::json::benchmark::benchmark(
+		  DAW_NUM_RUNS, json_doc.size( ), "name lookup",
+		  []( std::string_view sv ) {
+			  return from_json_array<message_t>( sv );
+		  },
+		  std::string_view( json_doc ) );
+		test_assert( result.has_value( ), "Expected a value" );
+		test_assert( result.get( ) == messages, "Expected the same messages" );
+	}
+	{
+		auto result = daw::json::benchmark::benchmark(
+		  DAW_NUM_RUNS, json_doc.size( ), "ordered members",
+		  []( std::string_view sv ) {
+			  return from_json_array<message_t>(
+			    sv, options::parse_flags<options::ExpectOrderedMembers::yes> );
+		  },
+		  std::string_view( json_doc ) );
+		test_assert( result.has_value( ), "Expected a value" );
+		test_assert( result.get( ) == messages, "Expected the same messages" );
+	}
+	{
+		auto result = daw::json::benchmark::benchmark(
+		  DAW_NUM_RUNS, json_doc.size( ), "ordered members unchecked",
+		  []( std::string_view sv ) {
+			  return from_json_array<message_t>(
+			    sv, options::parse_flags<options::ExpectOrderedMembers::yes,
+			                             options::CheckedParseMode::no> );
+		  },
+		  std::string_view( json_doc ) );
+		test_assert( result.has_value( ), "Expected a value" );
+		test_assert( result.get( ) == messages, "Expected the same messages" );
+	}
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
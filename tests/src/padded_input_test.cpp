@@ -0,0 +1,134 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  With options::PaddedInput the SIMD kernels read full blocks past the end
+//  of the document.  Fill the padding with quotes and backslashes and check
+//  that the results match a parse without the option
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_padded_string.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct padded_t {
+	std::string a;
+	std::vector<std::string> b;
+	int c;
+
+	bool operator==( padded_t const &rhs ) const {
+		return a == rhs.a and b == rhs.b and c == rhs.c;
+	}
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<padded_t> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		static constexpr char const c[] = "c";
+		using type =
+		  json_member_list<json_link<a, std::string>,
+		                   json_link<b, std::vector<std::string>>, json_link<c, int>>;
+	};
+} // namespace daw::json
+
+using namespace daw::json;
+
+// The document followed by padding that looks like string data to the kernels
+std::string make_padded( std::string_view doc ) {
+	auto result = std::string( doc );
+	for( std::size_t n = 0; n < json_input_padding; ++n ) {
+		result += n % 2 == 0 ? '"' : '\\';
+	}
+	return result;
+}
+
+template<options::ExecModeTypes ExecMode, options::CheckedParseMode Checked>
+void test_doc( std::string_view doc, padded_t const &expected ) {
+	auto const buff = make_padded( doc );
+	auto const padded_doc = std::string_view( buff.data( ), doc.size( ) );
+	auto const result = from_json<padded_t>(
+	  padded_doc,
+	  options::parse_flags<options::PaddedInput::yes, ExecMode, Checked> );
+	test_assert( result == expected, "Expected the same result when padded" );
+
+	auto const str = padded_string( doc );
+	auto const result2 = from_json<padded_t>(
+	  std::string_view( str ),
+	  options::parse_flags<options::PaddedInput::yes, ExecMode, Checked> );
+	test_assert( result2 == expected, "Expected the same result with a "
+	                                  "padded_string" );
+}
+
+template<options::ExecModeTypes ExecMode>
+void test_docs( std::string_view doc ) {
+	auto const expected = from_json<padded_t>( doc );
+	test_doc<ExecMode, options::CheckedParseMode::yes>( doc, expected );
+	test_doc<ExecMode, options::CheckedParseMode::no>( doc, expected );
+}
+
+template<options::ExecModeTypes ExecMode>
+void test_mode( ) {
+	test_docs<ExecMode>( R"({"a":"","b":[],"c":1})" );
+	test_docs<ExecMode>(
+	  R"({"a":"a string that is longer than a single block of data","b":["x","yy"],"c":2})" );
+	// Escapes at and around the 16 and 32 byte block boundaries
+	test_docs<ExecMode>(
+	  R"({"a":"0123456789\"bcde\\\"0123456789abcdef\\","b":["\\\\\"","012345678901234\"x"],"c":3})" );
+	// The last string ends at the end of the document
+	test_docs<ExecMode>( R"({"c":4,"b":[],"a":"ends at the end\""})" );
+	// Runs of indentation longer than a block, and whitespace up to the end
+	test_docs<ExecMode>(
+	  "{\n                                        \"a\" :\t\"x\",\n"
+	  "\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\"b\": [ \"y\" ,\r\n "
+	  "\"z\"\n ],\n  \"c\": 7\n}\n\n      " );
+	std::string long_str = R"({"c":5,"b":["y"],"a":")";
+	for( int n = 0; n < 100; ++n ) {
+		long_str += n % 7 == 0 ? R"(\")" : "z";
+	}
+	long_str += R"("})";
+	test_docs<ExecMode>( long_str );
+}
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_mode<options::ExecModeTypes::compile_time>( );
+	test_mode<options::ExecModeTypes::runtime>( );
+	test_mode<options::ExecModeTypes::simd>( );
+	test_mode<options::ExecModeTypes::avx2>( );
+
+	auto str = padded_string( std::string_view( R"({"a":"x","b":[],"c":6})" ) );
+	str.resize( 4 );
+	test_assert( std::string_view( str ) == R"({"a")", "Expected a resized "
+	                                                  "prefix" );
+	test_assert( str.data( )[str.size( ) + json_input_padding - 1] == '\0',
+	             "Expected zero padding" );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,207 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  Check that from_json_array_parallel gives the same result as
+//  from_json_array and time them on a large array of records
+//
+
+#include "daw_json_benchmark.h"
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_parallel.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 10;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t RECORD_COUNT = 1'000'000;
+#else
+static inline constexpr std::size_t RECORD_COUNT = 10'000;
+#endif
+
+struct record_t {
+	std::int64_t id;
+	std::string name;
+	double score;
+	std::vector<int> tags;
+
+	bool operator==( record_t const &rhs ) const {
+		return id == rhs.id and name == rhs.name and score == rhs.score and
+		       tags == rhs.tags;
+	}
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<record_t> {
+		static constexpr char const id[] = "id";
+		static constexpr char const name[] = "name";
+		static constexpr char const score[] = "score";
+		static constexpr char const tags[] = "tags";
+		using type = json_member_list<
+		  json_link<id, std::int64_t>, json_link<name, std::string>,
+		  json_link<score, double>, json_link<tags, std::vector<int>>>;
+	};
+} // namespace daw::json
+
+using namespace daw::json;
+
+std::string make_records( std::size_t count ) {
+	auto result = std::string( "[ " );
+	for( std::size_t n = 0; n < count; ++n ) {
+		if( n > 0 ) {
+			result += ",\n  ";
+		}
+		result += R"({"id":)" + std::to_string( n ) + R"(,"name":"record \")" +
+		          std::to_string( n ) + R"(\"","score":)" +
+		          std::to_string( static_cast<double>( n ) / 8.0 ) + R"(,"tags":[)";
+		for( std::size_t t = 0; t < n % 5; ++t ) {
+			if( t > 0 ) {
+				result += ',';
+			}
+			result += std::to_string( t );
+		}
+		result += "]}";
+	}
+	result += " ]\n";
+	return result;
+}
+
+void test_small( ) {
+	for( std::size_t count : { 0U, 1U, 2U, 3U, 17U, 1000U } ) {
+		auto const doc = make_records( count );
+		auto const expected = from_json_array<record_t>( doc );
+		test_assert( expected.size( ) == count, "Unexpected record count" );
+		for( std::size_t threads : { 1U, 2U, 3U, 8U, 64U } ) {
+			auto const result = from_json_array_parallel<record_t>( doc, threads );
+			test_assert( result == expected, "Expected the same records" );
+		}
+		auto const result_deque =
+		  from_json_array_parallel<record_t, std::deque<record_t>>( doc, 4 );
+		test_assert(
+		  std::equal( result_deque.begin( ), result_deque.end( ),
+		              expected.begin( ), expected.end( ) ),
+		  "Expected the same records in a deque" );
+	}
+	constexpr std::string_view ints = R"([1,2,3,4,5,6,7,8,9,10,11,12,13])";
+	test_assert( from_json_array_parallel<int>( ints, 4 ) ==
+	               from_json_array<int>( ints ),
+	             "Expected the same ints" );
+}
+
+void test_comments( ) {
+	constexpr std::string_view ints = "[1, // a, b]\n 2, /* \"[ */ 3]";
+	auto const result = from_json_array_parallel<int>(
+	  ints, options::parse_flags<options::PolicyCommentTypes::cpp>, 4 );
+	test_assert( result == std::vector<int>{ 1, 2, 3 },
+	             "Expected the commas in comments to be skipped" );
+
+	auto doc = make_records( 1000 );
+	for( auto pos = doc.find( ",\n" ); pos != std::string::npos;
+	     pos = doc.find( ",\n", pos + 12 ) ) {
+		doc.insert( pos + 1U, "# ], \"x\n" );
+	}
+	auto const expected = from_json_array<record_t>(
+	  doc, options::parse_flags<options::PolicyCommentTypes::hash> );
+	test_assert( expected.size( ) == 1000, "Unexpected record count" );
+	auto const records = from_json_array_parallel<record_t>(
+	  doc, options::parse_flags<options::PolicyCommentTypes::hash>, 4 );
+	test_assert( records == expected, "Expected the same records" );
+}
+
+void test_errors( ) {
+#ifdef DAW_USE_EXCEPTIONS
+	auto const expect_error = []( std::string_view doc, char const *msg ) {
+		try {
+			auto v = from_json_array_parallel<record_t>( doc, 4 );
+			(void)v;
+		} catch( daw::json::json_exception const & ) { return; }
+		daw_ensure_error( msg );
+	};
+	auto bad_element = make_records( 100 );
+	bad_element.replace( bad_element.find( R"("id":50)" ), 7, R"("id":"x")" );
+	expect_error( bad_element, "Expected an error for a bad element" );
+	auto unbalanced = make_records( 100 );
+	unbalanced.insert( unbalanced.find( R"({"id":50)" ), "[" );
+	expect_error( unbalanced, "Expected an error for unbalanced brackets" );
+	expect_error( R"({"a":[]})", "Expected an error when not an array" );
+	auto const trailing = make_records( 100 ) + "{}";
+	try {
+		auto v = from_json_array_parallel<record_t>(
+		  trailing, options::parse_flags<options::MustVerifyEndOfDataIsValid::yes>,
+		  4 );
+		(void)v;
+		daw_ensure_error( "Expected an error for trailing data" );
+	} catch( daw::json::json_exception const & ) {}
+#endif
+}
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_small( );
+	test_comments( );
+	test_errors( );
+
+	auto const json_doc = make_records( RECORD_COUNT );
+	auto const expected = from_json_array<record_t>( json_doc );
+	{
+		auto result = daw::json::benchmark::benchmark(
+		  DAW_NUM_RUNS, json_doc.size( ), "from_json_array",
+		  []( std::string_view sv ) {
+			  return from_json_array<record_t>( sv );
+		  },
+		  std::string_view( json_doc ) );
+		test_assert( result.has_value( ), "Expected a value" );
+	}
+	std::size_t const max_threads =
+	  std::max( std::thread::hardware_concurrency( ), 2U );
+	for( std::size_t threads = 1; threads <= max_threads; threads *= 2 ) {
+		auto const title =
+		  "from_json_array_parallel " + std::to_string( threads ) + " thread(s)";
+		auto result = daw::json::benchmark::benchmark(
+		  DAW_NUM_RUNS, json_doc.size( ), title,
+		  [threads]( std::string_view sv ) {
+			  return from_json_array_parallel<record_t>( sv, threads );
+		  },
+		  std::string_view( json_doc ) );
+		test_assert( result.has_value( ), "Expected a value" );
+		test_assert( result.get( ) == expected, "Expected the same records" );
+	}
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
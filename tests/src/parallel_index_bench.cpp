@@ -0,0 +1,158 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  Scaling of the multi-threaded structural indexer over 1..N threads.  The
+//  document is one large array of canada.json and citm_catalog.json repeated
+//  until it reaches the requested size in MB
+//
+
+#include "daw_json_benchmark.h"
+#include "defines.h"
+
+#include <daw/daw_read_file.h>
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_parallel.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <future>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 10;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DEFAULT_SIZE_MB = 256;
+#else
+static inline constexpr std::size_t DEFAULT_SIZE_MB = 8;
+#endif
+
+using namespace daw::json;
+using json_details::structural_index;
+
+bool same_index( structural_index const &lhs, structural_index const &rhs ) {
+	if( lhs.is_valid( ) != rhs.is_valid( ) or lhs.size( ) != rhs.size( ) ) {
+		return false;
+	}
+	for( std::size_t n = 0; n < lhs.size( ); ++n ) {
+		if( lhs[n].position != rhs[n].position or lhs[n].value != rhs[n].value ) {
+			return false;
+		}
+	}
+	return true;
+}
+
+std::size_t count_elements( std::vector<daw::string_view> const &parts ) {
+	auto counts = std::vector<std::future<std::size_t>>( );
+	for( auto const &part : parts ) {
+		counts.push_back( std::async( std::launch::async, [part] {
+			auto const rng = json_array_range<json_raw_no_name<>>( json_array_slice,
+			                                                       part );
+			std::size_t result = 0;
+			for( auto const &jv : rng ) {
+				daw::do_not_optimize( jv );
+				++result;
+			}
+			return result;
+		} ) );
+	}
+	std::size_t result = 0;
+	for( auto &c : counts ) {
+		result += c.get( );
+	}
+	return result;
+}
+
+int main( int argc, char **argv )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	if( argc < 3 ) {
+		std::cerr << "Must supply a path to canada.json and citm_catalog.json\n";
+		exit( 1 );
+	}
+	auto const canada_doc = *daw::read_file( argv[1] );
+	auto const citm_doc = *daw::read_file( argv[2] );
+	std::size_t const size_mb =
+	  argc > 3 ? std::strtoull( argv[3], nullptr, 10 ) : DEFAULT_SIZE_MB;
+
+	auto json_doc = std::string( "[" );
+	json_doc.reserve( size_mb * 1024U * 1024U + canada_doc.size( ) +
+	                  citm_doc.size( ) + 2U );
+	std::size_t doc_count = 0;
+	while( json_doc.size( ) < size_mb * 1024U * 1024U ) {
+		if( doc_count > 0 ) {
+			json_doc += ',';
+		}
+		json_doc += doc_count % 2 == 0 ? canada_doc : citm_doc;
+		++doc_count;
+	}
+	json_doc += ']';
+	std::cout << "Document of " << doc_count << " elements and "
+	          << json_doc.size( ) / ( 1024U * 1024U ) << "MB\n";
+
+	auto const single = structural_index( json_doc.data( ), json_doc.data( ) +
+	                                                          json_doc.size( ) );
+	test_assert( single.is_valid( ), "Expected a valid index" );
+
+	std::size_t const max_threads =
+	  std::max( std::thread::hardware_concurrency( ), 2U );
+	for( std::size_t threads = 1; threads <= max_threads; threads *= 2 ) {
+		auto const title = "index " + std::to_string( threads ) + " thread(s)";
+		auto result = daw::json::benchmark::benchmark(
+		  DAW_NUM_RUNS, json_doc.size( ), title,
+		  [threads]( std::string_view sv ) {
+			  return json_structural_index( sv, threads );
+		  },
+		  std::string_view( json_doc ) );
+		test_assert( result.has_value( ), "Expected a value" );
+		test_assert( same_index( result.get( ).index( ), single ),
+		             "Expected the same index for all thread counts" );
+	}
+
+	auto const index = json_structural_index( json_doc );
+	auto const boundaries = index.array_element_boundaries( );
+	test_assert( boundaries.size( ) == doc_count + 1U,
+	             "Expected a boundary between each element" );
+
+	auto const parts = index.partition_array_elements( max_threads );
+	test_assert( count_elements( parts ) == doc_count,
+	             "Expected to visit each element once" );
+
+	// Parse an element from the middle of the array
+	test_assert( doc_count > 2, "Expected more elements" );
+	auto const second = daw::string_view( boundaries[1] + 1, boundaries[2] + 1 );
+	auto const citm =
+	  from_json_array<json_raw_no_name<>>( json_array_slice, second );
+	test_assert( citm.size( ) == 1 and citm.front( ).find_member( "areaNames" ),
+	             "Expected the citm document" );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,161 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  The comma and name of class members are written from precomputed
+//  literals, along with the newline and indentation when pretty.  Check the
+//  output for each format, and when nested deeper than indent_run_levels
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <tuple>
+
+struct child_t {
+	int x;
+};
+
+struct record_t {
+	std::optional<std::string> name;
+	int id;
+	child_t child;
+};
+
+template<int N>
+struct wrap_t {
+	wrap_t<N - 1> inner;
+};
+
+template<>
+struct wrap_t<0> {
+	int v;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<child_t> {
+		static constexpr char const x[] = "x";
+		using type = json_member_list<json_number<x, int>>;
+
+		static inline auto to_json_data( child_t const &value ) {
+			return std::forward_as_tuple( value.x );
+		}
+	};
+
+	template<>
+	struct json_data_contract<record_t> {
+		static constexpr char const name[] = "name";
+		static constexpr char const id[] = "id";
+		static constexpr char const child[] = "child";
+		using type =
+		  json_member_list<json_string_null<name>, json_number<id, int>,
+		                   json_class<child, child_t>>;
+
+		static inline auto to_json_data( record_t const &value ) {
+			return std::forward_as_tuple( value.name, value.id, value.child );
+		}
+	};
+
+	template<int N>
+	struct json_data_contract<wrap_t<N>> {
+		static constexpr char const inner[] = "inner";
+		using type = json_member_list<json_class<inner, wrap_t<N - 1>>>;
+
+		static inline auto to_json_data( wrap_t<N> const &value ) {
+			return std::forward_as_tuple( value.inner );
+		}
+	};
+
+	template<>
+	struct json_data_contract<wrap_t<0>> {
+		static constexpr char const v[] = "v";
+		using type = json_member_list<json_number<v, int>>;
+
+		static inline auto to_json_data( wrap_t<0> const &value ) {
+			return std::forward_as_tuple( value.v );
+		}
+	};
+} // namespace daw::json
+
+using namespace daw::json;
+using namespace daw::json::options;
+
+constexpr int wrap_depth = 20;
+
+std::string indent( int level ) {
+	return std::string( static_cast<std::size_t>( level * 2 ), ' ' );
+}
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	auto const r = record_t{ "a", 1, { 2 } };
+	test_assert( to_json( r ) == R"({"name":"a","id":1,"child":{"x":2}})",
+	             "Expected the minified output" );
+	test_assert( to_json( record_t{ { }, 1, { 2 } } ) ==
+	               R"({"id":1,"child":{"x":2}})",
+	             "Expected no comma before the first member written" );
+	test_assert(
+	  to_json( r, output_flags<OutputTrailingComma::Yes> ) ==
+	    R"({"name":"a","id":1,"child":{"x":2,},})",
+	  "Expected the trailing commas" );
+
+	test_assert( to_json( r, output_flags<SerializationFormat::Pretty> ) ==
+	               "{\n"
+	               "  \"name\": \"a\",\n"
+	               "  \"id\": 1,\n"
+	               "  \"child\": {\n"
+	               "    \"x\": 2\n"
+	               "  }\n"
+	               "}",
+	             "Expected the pretty output" );
+	test_assert( to_json( r, output_flags<SerializationFormat::Pretty,
+	                                      IndentationType::Tab,
+	                                      NewLineDelimiter::rn> ) ==
+	               "{\r\n"
+	               "\t\"name\": \"a\",\r\n"
+	               "\t\"id\": 1,\r\n"
+	               "\t\"child\": {\r\n"
+	               "\t\t\"x\": 2\r\n"
+	               "\t}\r\n"
+	               "}",
+	             "Expected the pretty output with tabs" );
+
+	auto const w = wrap_t<wrap_depth>{ };
+	auto expected = std::string( "{" );
+	for( int n = 1; n <= wrap_depth; ++n ) {
+		expected += "\n" + indent( n ) + "\"inner\": {";
+	}
+	expected += "\n" + indent( wrap_depth + 1 ) + "\"v\": 0";
+	for( int n = wrap_depth; n >= 0; --n ) {
+		expected += "\n" + indent( n ) + "}";
+	}
+	auto const w_json = to_json( w, output_flags<SerializationFormat::Pretty> );
+	test_assert( w_json == expected, "Expected the deeply nested output" );
+	(void)from_json<wrap_t<wrap_depth>>( w_json );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,144 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  basic_stateful_json_value indexes the member names of large objects.  Check
+//  lookups in any order and time random access to a large object
+//
+
+#include "daw_json_benchmark.h"
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_value_state.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+using namespace daw::json;
+
+std::string member_name( std::size_t n ) {
+	return "setting_" + std::to_string( n );
+}
+
+std::string make_config( std::size_t count ) {
+	auto result = std::string( "{" );
+	for( std::size_t n = 0; n < count; ++n ) {
+		if( n > 0 ) {
+			result += ',';
+		}
+		result += '"' + member_name( n ) + R"(":)" + std::to_string( n );
+	}
+	// A duplicate, the first one is found
+	result += R"(,"setting_3":-1})";
+	return result;
+}
+
+// Visit the members in an order that jumps around the object
+std::vector<std::string> make_queries( std::size_t count ) {
+	auto result = std::vector<std::string>( );
+	for( std::size_t n = 0; n < count; ++n ) {
+		result.push_back( member_name( ( n * 7919U ) % count ) );
+	}
+	return result;
+}
+
+void test_lookups( ) {
+	constexpr std::size_t count = 500;
+	auto const doc = make_config( count );
+	auto const queries = make_queries( count );
+	{
+		auto state = json_value_state( doc );
+		for( auto const &q : queries ) {
+			auto const expected = std::stoi( q.substr( 8 ) );
+			test_assert( from_json<int>( state[q] ) == expected,
+			             "Expected the value of the member" );
+			test_assert( state.index_of( q ) == static_cast<std::size_t>( expected ),
+			             "Expected the position of the member" );
+		}
+		test_assert( from_json<int>( state["setting_3"] ) == 3,
+		             "Expected the first of the duplicates" );
+		test_assert( not state.contains( "setting_500" ), "Unexpected member" );
+		test_assert( not state.contains( "" ), "Unexpected member" );
+		test_assert( state.size( ) == count + 1U, "Unexpected size" );
+		test_assert( *state.name_of( 10 ) == "setting_10", "Unexpected name" );
+
+		state.reset( basic_json_value( R"({"a":1,"b":2})" ) );
+		test_assert( from_json<int>( state["b"] ) == 2, "Expected b after reset" );
+		test_assert( not state.contains( "setting_3" ), "Unexpected member" );
+	}
+	{
+		auto state = json_value_state( doc );
+		test_assert( state.index_members( ) == count + 1U, "Unexpected count" );
+		for( auto const &q : queries ) {
+			test_assert( from_json<int>( state[json_member_name( q )] ) ==
+			               std::stoi( q.substr( 8 ) ),
+			             "Expected the value of the member" );
+		}
+		test_assert( from_json<int>( state["setting_3"] ) == 3,
+		             "Expected the first of the duplicates" );
+	}
+	{
+		// Small objects are searched linearly
+		auto state = json_value_state( R"({"x":1,"y":2,"z":3,"x":4})" );
+		test_assert( from_json<int>( state["z"] ) == 3, "Expected z" );
+		test_assert( from_json<int>( state["x"] ) == 1, "Expected the first x" );
+		test_assert( state.index_members( ) == 4, "Unexpected count" );
+		test_assert( from_json<int>( state["y"] ) == 2, "Expected y" );
+	}
+}
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_lookups( );
+
+	constexpr std::size_t count = 2000;
+	auto const doc = make_config( count );
+	auto queries = make_queries( count );
+	auto const member_names = std::vector<json_member_name>(
+	  std::begin( queries ), std::end( queries ) );
+	auto result = daw::json::benchmark::benchmark(
+	  DAW_NUM_RUNS, doc.size( ), "random member access",
+	  [&]( std::string_view sv ) {
+		  auto state = json_value_state( sv );
+		  std::size_t sum = 0;
+		  for( auto const &m : member_names ) {
+			  sum += state[m].get_string_view( ).size( );
+		  }
+		  return sum;
+	  },
+	  std::string_view( doc ) );
+	test_assert( result.has_value( ), "Expected a value" );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,167 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  json_string_arena members are views of the document when the string has no
+//  escapes, and views of the decoded string in the parse allocator otherwise
+//
+
+#include "defines.h"
+
+#include "fixed_alloc.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+
+struct escaped_t {
+	std::string a;
+	std::string b;
+};
+
+struct arena_t {
+	std::string_view a;
+	std::string_view b;
+	std::optional<std::string_view> c;
+};
+
+struct ascii_t {
+	std::string_view a;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<escaped_t> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		using type =
+		  json_member_list<json_link<a, std::string>, json_link<b, std::string>>;
+	};
+
+	template<>
+	struct json_data_contract<arena_t> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		static constexpr char const c[] = "c";
+		using type = json_member_list<json_string_arena<a>, json_string_arena<b>,
+		                              json_string_arena_null<c>>;
+	};
+
+	template<>
+	struct json_data_contract<ascii_t> {
+		static constexpr char const a[] = "a";
+		using type = json_member_list<json_string_arena<
+		  a, std::string_view,
+		  options::string_opt( options::EightBitModes::DisallowHigh )>>;
+	};
+} // namespace daw::json
+
+using namespace daw::json;
+
+constexpr std::string_view escapes[] = {
+  R"(\")",          R"(\\)",
+  R"(\/)",          R"(\b)",
+  R"(\f)",          R"(\n)",
+  R"(\r)",          R"(\t)",
+  R"(\u0041)",      R"(\u00e9)",
+  R"(\u20AC)",      R"(\uD83D\uDE00)",
+  R"(\\\"\\\")",    R"(C:\\logs\\a.txt)" };
+
+bool is_in( std::string_view value, std::string const &doc ) {
+	return std::data( value ) >= std::data( doc ) and
+	       daw::data_end( value ) <= daw::data_end( doc );
+}
+
+template<options::ExecModeTypes ExecMode>
+void test_mode( daw::fixed_allocator<char> &alloc ) {
+	for( std::size_t pad = 0; pad < 40; ++pad ) {
+		auto const p = std::string( pad, 'x' );
+		for( auto esc : escapes ) {
+			auto const e = std::string( esc );
+			auto const doc =
+			  R"({"a":")" + p + e + p + e + R"(","b":")" + p + R"("})";
+			auto const expected = from_json<escaped_t>( doc );
+			alloc.release( );
+			auto const result =
+			  from_json_alloc<arena_t>( doc, alloc, options::parse_flags<ExecMode> );
+			test_assert( result.a == expected.a and result.b == expected.b and
+			               not result.c,
+			             "Expected the same result" );
+			test_assert( not is_in( result.a, doc ) and is_in( result.b, doc ),
+			             "Expected only the escaped value in the arena" );
+			test_assert( alloc.used( ) > 0, "Expected an arena allocation" );
+
+			auto buffer = doc;
+			auto const in_situ = from_json<arena_t>(
+			  buffer, options::parse_flags<ExecMode, options::InSituStrings::yes> );
+			test_assert( in_situ.a == expected.a and in_situ.b == expected.b,
+			             "Expected the same result in place" );
+			test_assert( is_in( in_situ.a, buffer ),
+			             "Expected the value to be decoded in place" );
+		}
+	}
+	alloc.release( );
+	auto const plain = std::string( R"({"a":"plain","b":""})" );
+	auto const v =
+	  from_json_alloc<arena_t>( plain, alloc, options::parse_flags<ExecMode> );
+	test_assert( v.a == "plain" and v.b.empty( ) and not v.c,
+	             "Expected the plain values" );
+	test_assert( alloc.used( ) == 0, "Expected no arena allocations" );
+
+	auto const nullable = std::string( R"({"a":"","b":"","c":"a\tb"})" );
+	auto const v2 =
+	  from_json_alloc<arena_t>( nullable, alloc, options::parse_flags<ExecMode> );
+	test_assert( v2.c == "a\tb", "Expected the decoded nullable value" );
+
+	auto const ascii = std::string( R"({"a":"caf\u00e9\n"})" );
+	auto const v3 =
+	  from_json_alloc<ascii_t>( ascii, alloc, options::parse_flags<ExecMode> );
+	test_assert( v3.a == "caf\xc3\xa9\n", "Expected the decoded value" );
+#ifdef DAW_USE_EXCEPTIONS
+	for( auto high : { std::string( "{\"a\":\"caf\xc3\xa9\"}" ),
+	                   std::string( "{\"a\":\"caf\xc3\xa9\\n\"}" ) } ) {
+		bool has_error = false;
+		try {
+			(void)from_json_alloc<ascii_t>( high, alloc,
+			                                options::parse_flags<ExecMode> );
+		} catch( json_exception const &jex ) {
+			has_error = jex.reason_type( ) == ErrorReason::InvalidStringHighASCII;
+		}
+		test_assert( has_error, "Expected an error for the high bit" );
+	}
+#endif
+}
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	auto alloc = daw::fixed_allocator<char>( 1024U * 1024U );
+	test_mode<options::ExecModeTypes::compile_time>( alloc );
+	test_mode<options::ExecModeTypes::runtime>( alloc );
+	test_mode<options::ExecModeTypes::simd>( alloc );
+	test_mode<options::ExecModeTypes::avx2>( alloc );
+	test_mode<options::ExecModeTypes::dispatch>( alloc );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,189 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  json_string_interned members store each distinct value once in the string
+//  intern table of the parsing thread.  Equal values have the same data( )
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_lines_iterator.h>
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_string_intern.h>
+
+#include <cstdlib>
+#include <future>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+template<typename Table>
+struct basic_record_t {
+	std::string_view lang;
+	std::optional<std::string_view> country;
+	int id;
+};
+
+namespace daw::json {
+	template<typename Table>
+	struct json_data_contract<basic_record_t<Table>> {
+		static constexpr char const lang[] = "lang";
+		static constexpr char const country[] = "country";
+		static constexpr char const id[] = "id";
+		using type =
+		  json_member_list<json_string_interned<lang, Table>,
+		                   json_string_interned_null<country, Table>,
+		                   json_number<id, int>>;
+	};
+} // namespace daw::json
+
+struct ascii_t {
+	std::string_view a;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<ascii_t> {
+		static constexpr char const a[] = "a";
+		using type = json_member_list<json_string_interned<
+		  a, string_intern_table, std::string_view,
+		  options::string_opt( options::EightBitModes::DisallowHigh )>>;
+	};
+} // namespace daw::json
+
+using record_t = basic_record_t<daw::json::string_intern_table>;
+using shared_record_t =
+  basic_record_t<daw::json::concurrent_string_intern_table>;
+
+using namespace daw::json;
+
+constexpr std::string_view langs[] = { "en", "fr", "de", "ja", "es" };
+
+std::string make_jsonl( std::size_t count ) {
+	auto result = std::string( );
+	for( std::size_t n = 0; n < count; ++n ) {
+		result += R"({"lang":")";
+		result += langs[n % std::size( langs )];
+		result += R"(","id":)" + std::to_string( n );
+		if( n % 3 == 0 ) {
+			result += R"(,"country":"C\u00f4te d'Ivoire")";
+		}
+		result += "}\n";
+	}
+	return result;
+}
+
+template<options::ExecModeTypes ExecMode>
+void test_mode( std::string const &doc ) {
+	auto table = string_intern_table( );
+	auto const scope = string_intern_scope( table );
+	auto values = std::vector<record_t>( );
+	for( auto const &r :
+	     json_lines_range<record_t, ExecMode>( daw::string_view( doc ) ) ) {
+		values.push_back( r );
+	}
+	test_assert( values.size( ) == 100, "Expected all of the records" );
+	for( std::size_t n = 0; n < values.size( ); ++n ) {
+		auto const &v = values[n];
+		auto const &first = values[n % std::size( langs )];
+		test_assert( v.lang == langs[n % std::size( langs )] and
+		               std::data( v.lang ) == std::data( first.lang ),
+		             "Expected equal values to share storage" );
+		test_assert( ( n % 3 == 0 ) == v.country.has_value( ),
+		             "Expected the nullable member" );
+		if( v.country ) {
+			test_assert( *v.country == "C\xc3\xb4te d'Ivoire" and
+			               std::data( *v.country ) ==
+			                 std::data( *values[0].country ),
+			             "Expected the decoded value to be interned" );
+		}
+	}
+	test_assert( table.size( ) == std::size( langs ) + 1,
+	             "Expected each distinct value once" );
+
+	auto const ascii = from_json<ascii_t>(
+	  R"({"a":"C\u00f4te"})", options::parse_flags<ExecMode> );
+	test_assert( ascii.a == "C\xc3\xb4te", "Expected the decoded value" );
+#ifdef DAW_USE_EXCEPTIONS
+	bool has_error = false;
+	try {
+		(void)from_json<ascii_t>( "{\"a\":\"C\xc3\xb4te\"}",
+		                          options::parse_flags<ExecMode> );
+	} catch( json_exception const &jex ) {
+		has_error = jex.reason_type( ) == ErrorReason::InvalidStringHighASCII;
+	}
+	test_assert( has_error, "Expected an error for the high bit" );
+#endif
+}
+
+void test_shared( std::string const &doc ) {
+	auto table = concurrent_string_intern_table( );
+	auto const parts =
+	  partition_jsonl_document<shared_record_t>( 4, daw::string_view( doc ) );
+	auto results = std::vector<std::future<std::vector<char const *>>>( );
+	for( auto const &part : parts ) {
+		results.push_back( std::async( std::launch::async, [&] {
+			auto const scope = string_intern_scope( table );
+			auto langs_seen = std::vector<char const *>( );
+			for( shared_record_t const &r : part ) {
+				langs_seen.push_back( std::data( r.lang ) );
+			}
+			return langs_seen;
+		} ) );
+	}
+	auto seen = std::vector<char const *>( );
+	for( auto &r : results ) {
+		auto const part = r.get( );
+		seen.insert( seen.end( ), part.begin( ), part.end( ) );
+	}
+	test_assert( seen.size( ) == 100, "Expected all of the records" );
+	for( std::size_t n = 0; n < seen.size( ); ++n ) {
+		test_assert( seen[n] == seen[n % std::size( langs )],
+		             "Expected equal values to share storage across threads" );
+	}
+	test_assert( table.size( ) == std::size( langs ) + 1,
+	             "Expected each distinct value once" );
+}
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	auto const doc = make_jsonl( 100 );
+	test_mode<options::ExecModeTypes::compile_time>( doc );
+	test_mode<options::ExecModeTypes::runtime>( doc );
+	test_mode<options::ExecModeTypes::simd>( doc );
+	test_mode<options::ExecModeTypes::avx2>( doc );
+	test_mode<options::ExecModeTypes::dispatch>( doc );
+	test_shared( doc );
+#ifdef DAW_USE_EXCEPTIONS
+	bool has_error = false;
+	try {
+		(void)from_json<record_t>( R"({"lang":"en","id":1})" );
+	} catch( json_exception const &jex ) {
+		has_error = jex.reason_type( ) == ErrorReason::MissingStringInternTable;
+	}
+	test_assert( has_error, "Expected an error without a table in scope" );
+#endif
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,167 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  Check that skipping through options::StructuralIndex gives the same results
+//  as scanning
+//
+
+#include "defines.h"
+
+#include "citm_test_json.h"
+#include "twitter_test_json.h"
+
+#include <daw/daw_read_file.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct out_of_order_t {
+	std::string_view a;
+	std::vector<int> b;
+	std::string c;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<out_of_order_t> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		static constexpr char const c[] = "c";
+		using type = json_member_list<json_link<a, std::string_view>,
+		                              json_link<b, std::vector<int>>,
+		                              json_link<c, std::string>>;
+	};
+} // namespace daw::json
+
+using namespace daw::json;
+using json_details::structural_index;
+
+void test_index_links( ) {
+	constexpr std::string_view doc =
+	  R"({"a\"{":[1,{"b":"\\"},3],"c":"x\n,]","d":{}})";
+	auto const index = structural_index( doc.data( ), doc.data( ) + doc.size( ) );
+	test_assert( index.is_valid( ), "Expected a valid index" );
+
+	auto const root = index.find( doc.data( ) );
+	test_assert( root == 0, "Expected the root class to be first" );
+	auto const root_close = index[root].value;
+	test_assert( index.pointer_to( root_close ) == doc.data( ) + doc.size( ) - 1,
+	             "Expected the root to close at the end" );
+	test_assert( index[root_close].value == 2, "Expected 2 commas in root" );
+
+	auto const name = index.find( doc.data( ) + 1 );
+	test_assert( name != structural_index::npos, "Expected a quote" );
+	test_assert( index[index[name].value].value == 1,
+	             "Expected escape at offset 1 of the first name" );
+
+	auto const array_pos = doc.find( '[' );
+	auto const array = index.find( doc.data( ) + array_pos );
+	auto const array_close = index[array].value;
+	test_assert( std::string_view( doc.data( ) + array_pos,
+	                               static_cast<std::size_t>(
+	                                 index.pointer_to( array_close ) -
+	                                 ( doc.data( ) + array_pos ) ) +
+	                                 1U ) == R"([1,{"b":"\\"},3])",
+	             "Unexpected array range" );
+	test_assert( index[array_close].value == 2, "Expected 2 commas in array" );
+
+	auto const in_string = doc.find( ",]" );
+	test_assert( index.find( doc.data( ) + in_string ) == structural_index::npos,
+	             "Characters inside of strings are not structural" );
+}
+
+void test_invalid_index( ) {
+	constexpr std::string_view unbalanced = R"({"a":[1,2}})";
+	test_assert( not structural_index( unbalanced.data( ),
+	                                   unbalanced.data( ) + unbalanced.size( ) )
+	                   .is_valid( ),
+	             "Expected an invalid index for unbalanced brackets" );
+	constexpr std::string_view unterminated = R"({"a":"abc})";
+	test_assert(
+	  not structural_index( unterminated.data( ),
+	                        unterminated.data( ) + unterminated.size( ) )
+	        .is_valid( ),
+	  "Expected an invalid index for an unterminated string" );
+}
+
+template<typename T>
+void compare_parse( std::string_view doc, char const *title ) {
+	auto const scanned = from_json<T>( doc );
+	auto const indexed =
+	  from_json<T>( doc, options::parse_flags<options::StructuralIndex::yes> );
+	test_assert( to_json( scanned ) == to_json( indexed ), title );
+	auto const indexed_unchecked =
+	  from_json<T>( doc, options::parse_flags<options::StructuralIndex::yes,
+	                                          options::CheckedParseMode::no> );
+	test_assert( to_json( scanned ) == to_json( indexed_unchecked ), title );
+}
+
+void test_out_of_order( ) {
+	constexpr std::string_view doc =
+	  R"({"x":{"y":[1,2,{"z":"}"}]},"c":"a\"b","b":[1,2,3],"w":["\\",[]],"a":"first"})";
+	for( auto const &value :
+	     { from_json<out_of_order_t>( doc ),
+	       from_json<out_of_order_t>(
+	         doc, options::parse_flags<options::StructuralIndex::yes> ) } ) {
+		test_assert( value.a == "first", "Unexpected value for a" );
+		test_assert( value.b == std::vector<int>{ 1, 2, 3 },
+		             "Unexpected value for b" );
+		test_assert( value.c == "a\"b", "Unexpected value for c" );
+	}
+}
+
+void test_bad_document( ) {
+#ifdef DAW_USE_EXCEPTIONS
+	// The index is invalid, the scanner must still find the error
+	constexpr std::string_view doc = R"({"x":{"y":[1,2}},"a":"a","b":[],"c":""})";
+	try {
+		auto v = from_json<out_of_order_t>(
+		  doc, options::parse_flags<options::StructuralIndex::yes> );
+		(void)v;
+	} catch( daw::json::json_exception const & ) { return; }
+	daw_ensure_error( "Expected an exception for unbalanced brackets" );
+#endif
+}
+
+int main( int argc, char **argv )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	if( argc < 3 ) {
+		std::cerr << "Must supply a path to twitter.json and citm_catalog.json\n";
+		exit( 1 );
+	}
+	auto const twitter_doc = *daw::read_file( argv[1] );
+	auto const citm_doc = *daw::read_file( argv[2] );
+
+	test_index_links( );
+	test_invalid_index( );
+	test_out_of_order( );
+	test_bad_document( );
+
+	compare_parse<daw::twitter::twitter_object_t>( twitter_doc, "twitter" );
+	compare_parse<daw::citm::citm_object_t>( citm_doc, "citm" );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
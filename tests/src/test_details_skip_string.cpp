@@ -140,6 +140,52 @@ bool test_escaped_quote_004( ) {
 	return v.size( ) == 66;
 }
 
+template<daw::json::options::ExecModeTypes ExecMode>
+bool test_escaped_quote_005( ) {
+	// The escape is the last character of the first 32 byte block
+	DAW_CONSTEXPR std::string_view sv =
+	  R"( "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\"bcd"                                        )";
+	DAW_CONSTEXPR std::string_view sv2 = sv.substr( 1 );
+	using namespace daw::json;
+	using namespace daw::json::json_details;
+	auto rng = BasicParsePolicy<parse_options( ExecMode )>(
+	  std::data( sv2 ), daw::data_end( sv2 ) );
+	auto v = skip_string( rng );
+	return v.size( ) == 36;
+}
+
+template<daw::json::options::ExecModeTypes ExecMode>
+bool test_first_escape( std::string_view sv, std::ptrdiff_t expected ) {
+	using namespace daw::json;
+	using namespace daw::json::json_details;
+	auto rng = BasicParsePolicy<parse_options( ExecMode )>(
+	  std::data( sv ), daw::data_end( sv ) );
+	auto v = skip_string( rng );
+	if( expected < 0 ) {
+		return not needs_slow_path( v );
+	}
+	return needs_slow_path( v ) and
+	       static_cast<std::ptrdiff_t>( v.counter ) == expected;
+}
+
+/***
+ * skip_string stores the offset of the first escape in the string.  The
+ * escapes are in the tail of the buffer, the first block and a later block
+ */
+template<daw::json::options::ExecModeTypes ExecMode>
+bool test_first_escape_001( ) {
+	return test_first_escape<ExecMode>( R"("x\"x")", 1 ) and
+	       test_first_escape<ExecMode>(
+	         R"("x\"x"                                        )", 1 ) and
+	       test_first_escape<ExecMode>(
+	         R"("abcdefghijklmnopqrstuvwxyz0123456789\n"         )", 36 ) and
+	       test_first_escape<ExecMode>(
+	         R"("abcdefghijklmnopqrstuvwxyz0123456789"           )", -1 ) and
+	       // An escape after the closing quote is not part of the string
+	       test_first_escape<ExecMode>(
+	         R"("abc","\n"                                          )", -1 );
+}
+
 #define do_test( ... )                                                 \
 	try {                                                                \
 		if( not( __VA_ARGS__ ) ) {                                         \
@@ -189,11 +235,41 @@ int main( int, char ** )
 	  test_escaped_quote_003<daw::json::options::ExecModeTypes::runtime>( ) );
 	do_test(
 	  test_escaped_quote_004<daw::json::options::ExecModeTypes::runtime>( ) );
+	do_test( test_escaped_quote_005<
+	         daw::json::options::ExecModeTypes::compile_time>( ) );
+	do_test(
+	  test_escaped_quote_005<daw::json::options::ExecModeTypes::runtime>( ) );
+	do_test(
+	  test_escaped_quote_001<daw::json::options::ExecModeTypes::dispatch>( ) );
+	do_test(
+	  test_escaped_quote_002<daw::json::options::ExecModeTypes::dispatch>( ) );
+	do_test(
+	  test_escaped_quote_003<daw::json::options::ExecModeTypes::dispatch>( ) );
+	do_test(
+	  test_escaped_quote_004<daw::json::options::ExecModeTypes::dispatch>( ) );
+	do_test(
+	  test_escaped_quote_005<daw::json::options::ExecModeTypes::dispatch>( ) );
+	do_test( test_first_escape_001<
+	         daw::json::options::ExecModeTypes::compile_time>( ) );
+	do_test(
+	  test_first_escape_001<daw::json::options::ExecModeTypes::runtime>( ) );
+	do_test(
+	  test_first_escape_001<daw::json::options::ExecModeTypes::dispatch>( ) );
 #if defined( DAW_ALLOW_SSE42 )
 	do_test( test_escaped_quote_001<daw::json::options::ExecModeTypes::simd>( ) );
 	do_test( test_escaped_quote_002<daw::json::options::ExecModeTypes::simd>( ) );
 	do_test( test_escaped_quote_003<daw::json::options::ExecModeTypes::simd>( ) );
 	do_test( test_escaped_quote_004<daw::json::options::ExecModeTypes::simd>( ) );
+	do_test( test_escaped_quote_005<daw::json::options::ExecModeTypes::simd>( ) );
+	do_test( test_first_escape_001<daw::json::options::ExecModeTypes::simd>( ) );
+#endif
+#if defined( DAW_ALLOW_AVX2 )
+	do_test( test_escaped_quote_001<daw::json::options::ExecModeTypes::avx2>( ) );
+	do_test( test_escaped_quote_002<daw::json::options::ExecModeTypes::avx2>( ) );
+	do_test( test_escaped_quote_003<daw::json::options::ExecModeTypes::avx2>( ) );
+	do_test( test_escaped_quote_004<daw::json::options::ExecModeTypes::avx2>( ) );
+	do_test( test_escaped_quote_005<daw::json::options::ExecModeTypes::avx2>( ) );
+	do_test( test_first_escape_001<daw::json::options::ExecModeTypes::avx2>( ) );
 #endif
 	do_fail_test( test_missing_quotes_001( ) );
 	do_fail_test( test_missing_quotes_002( ) );
@@ -206,6 +206,9 @@ int main( int argc, char **argv )
 	if constexpr( not std::is_same_v<runtime_exec_tag, simd_exec_tag> ) {
 		test<ExecModeTypes::simd>( json_data );
 	}
+	if constexpr( not std::is_same_v<simd_exec_tag, avx2_exec_tag> ) {
+		test<ExecModeTypes::avx2>( json_data );
+	}
 
 	// ******************************
 	// Test serialization
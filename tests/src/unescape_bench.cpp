@@ -0,0 +1,120 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  Parses log records whose strings are full of escapes, Windows paths and
+//  quoted JSON documents, in each exec mode
+//
+
+#include "defines.h"
+
+#include "daw_json_benchmark.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 250;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+struct log_record {
+	std::string path;
+	std::string payload;
+	std::string message;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<log_record> {
+		static constexpr char const path[] = "path";
+		static constexpr char const payload[] = "payload";
+		static constexpr char const message[] = "message";
+		using type = json_member_list<json_link<path, std::string>,
+		                              json_link<payload, std::string>,
+		                              json_link<message, std::string>>;
+	};
+} // namespace daw::json
+
+using namespace daw::json;
+
+std::string make_doc( std::size_t count ) {
+	std::string result = "[";
+	for( std::size_t n = 0; n < count; ++n ) {
+		if( n > 0 ) {
+			result += ',';
+		}
+		auto const id = std::to_string( n );
+		result += R"({"path":"C:\\Program Files\\service\\logs\\)" + id +
+		          R"(\\output.log","payload":"{\"id\":)" + id +
+		          R"(,\"user\":\"name \\\"quoted\\\"\",\"tags\":[\"a\",\"b\"]}",)" +
+		          R"("message":"line one\nline two\n\tindented \u00e9\u20ac"})";
+	}
+	result += ']';
+	return result;
+}
+
+template<options::ExecModeTypes ExecMode, options::CheckedParseMode Checked>
+void test( std::string_view doc ) {
+	std::cout << "Using " << to_string( ExecMode ) << " exec model "
+	          << ( Checked == options::CheckedParseMode::yes ? "checked"
+	                                                         : "unchecked" )
+	          << "\n*********************************************\n";
+	auto ret = daw::json::benchmark::benchmark(
+	  DAW_NUM_RUNS, doc.size( ), "escaped log records",
+	  []( auto const &sv ) {
+		  return from_json<std::vector<log_record>>(
+		    sv, options::parse_flags<ExecMode, Checked> );
+	  },
+	  doc );
+	test_assert( ret.has_value( ), "Expected a value" );
+	test_assert( ret.get( ).back( ).message ==
+	               "line one\nline two\n\tindented \xc3\xa9\xe2\x82\xac",
+	             "Expected the decoded text" );
+}
+
+template<options::ExecModeTypes ExecMode>
+void test_mode( std::string_view doc ) {
+	test<ExecMode, options::CheckedParseMode::yes>( doc );
+	test<ExecMode, options::CheckedParseMode::no>( doc );
+}
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	auto const doc = make_doc( 10'000 );
+	test_mode<options::ExecModeTypes::runtime>( doc );
+	if constexpr( not std::is_same_v<simd_exec_tag, runtime_exec_tag> ) {
+		test_mode<options::ExecModeTypes::simd>( doc );
+	}
+	if constexpr( not std::is_same_v<avx2_exec_tag, simd_exec_tag> ) {
+		test_mode<options::ExecModeTypes::avx2>( doc );
+	}
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
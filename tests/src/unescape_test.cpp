@@ -0,0 +1,122 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  The SIMD exec modes copy the runs between escapes a block at a time, and
+//  runs of escapes are decoded without searching again.  Check escapes at and
+//  across the 16 and 32 byte block boundaries against the compile_time exec
+//  mode
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+struct escaped_t {
+	std::string a;
+	std::string b;
+
+	bool operator==( escaped_t const &rhs ) const {
+		return a == rhs.a and b == rhs.b;
+	}
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<escaped_t> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		using type =
+		  json_member_list<json_link<a, std::string>, json_link<b, std::string>>;
+	};
+} // namespace daw::json
+
+using namespace daw::json;
+
+constexpr std::string_view escapes[] = {
+  R"(\")",          R"(\\)",
+  R"(\/)",          R"(\b)",
+  R"(\f)",          R"(\n)",
+  R"(\r)",          R"(\t)",
+  R"(\u0041)",      R"(\u00e9)",
+  R"(\u20AC)",      R"(\uD83D\uDE00)",
+  R"(\\\"\\\")",    R"(C:\\logs\\a.txt)" };
+
+template<options::ExecModeTypes ExecMode, options::CheckedParseMode Checked>
+void test_doc( std::string const &doc ) {
+	auto const expected = from_json<escaped_t>(
+	  doc, options::parse_flags<options::ExecModeTypes::compile_time> );
+	auto const result =
+	  from_json<escaped_t>( doc, options::parse_flags<ExecMode, Checked> );
+	test_assert( result == expected, "Expected the same result" );
+}
+
+template<options::ExecModeTypes ExecMode>
+void test_mode( ) {
+	for( std::size_t pad = 0; pad < 40; ++pad ) {
+		auto const p = std::string( pad, 'x' );
+		for( auto esc : escapes ) {
+			auto const e = std::string( esc );
+			auto const doc =
+			  R"({"a":")" + p + e + p + e + e + R"(","b":")" + e + p + R"("})";
+			test_doc<ExecMode, options::CheckedParseMode::yes>( doc );
+			test_doc<ExecMode, options::CheckedParseMode::no>( doc );
+		}
+	}
+	// JSON in JSON
+	auto const nested = std::string(
+	  R"({"a":"{\"path\":\"C:\\\\logs\\\\app\\\\\",\"msg\":\"line1\\nline2\"}","b":"\\\\\\\\"})" );
+	test_doc<ExecMode, options::CheckedParseMode::yes>( nested );
+	auto const v = from_json<escaped_t>( nested, options::parse_flags<ExecMode> );
+	test_assert( v.a == R"({"path":"C:\\logs\\app\\","msg":"line1\nline2"})",
+	             "Expected the decoded JSON" );
+	test_assert( v.b == R"(\\\\)", "Expected the decoded backslashes" );
+#ifdef DAW_USE_EXCEPTIONS
+	bool has_error = false;
+	try {
+		(void)from_json<escaped_t>( R"({"a":"\u12G4","b":""})",
+		                            options::parse_flags<ExecMode> );
+	} catch( json_exception const & ) {
+		has_error = true;
+	}
+	test_assert( has_error, "Expected an invalid unicode escape error" );
+#endif
+}
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_mode<options::ExecModeTypes::compile_time>( );
+	test_mode<options::ExecModeTypes::runtime>( );
+	test_mode<options::ExecModeTypes::simd>( );
+	test_mode<options::ExecModeTypes::avx2>( );
+	test_mode<options::ExecModeTypes::dispatch>( );
+	auto const v =
+	  from_json<escaped_t>( R"({"a":"\u00e9\u20ac\ud83d\ude00","b":"\t"})" );
+	test_assert( v.a == "\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80" and v.b == "\t",
+	             "Expected the decoded text" );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,126 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  Compares parsing without UTF-8 checks, with options::ValidateUTF8 checking
+//  the strings as they are parsed, and with a separate pass over the document
+//  before the parse
+//
+
+#include "defines.h"
+
+#include "daw_json_benchmark.h"
+#include "twitter_test_json.h"
+
+#include <daw/daw_read_file.h>
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_validate.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 250;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+struct unicode_data {
+	std::string escaped;
+	std::string unicode;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<unicode_data> {
+		static constexpr char const escaped[] = "escaped";
+		static constexpr char const unicode[] = "unicode";
+		using type = json_member_list<json_string<escaped>, json_string<unicode>>;
+	};
+} // namespace daw::json
+
+using namespace daw::json;
+
+template<typename T, options::ExecModeTypes ExecMode>
+void test_doc( std::string_view name, std::string_view doc ) {
+	auto const bench = [&]( std::string_view title, auto flags ) {
+		auto ret = daw::json::benchmark::benchmark(
+		  DAW_NUM_RUNS, doc.size( ), std::string( name ) + std::string( title ),
+		  [&]( auto const &sv ) {
+			  return from_json<T>( sv, flags );
+		  },
+		  doc );
+		test_assert( ret.has_value( ), "Expected a value" );
+	};
+	bench( " no UTF-8 checks", options::parse_flags<ExecMode> );
+	bench( " ValidateUTF8::values",
+	       options::parse_flags<ExecMode, options::ValidateUTF8::values> );
+	bench(
+	  " ValidateUTF8::values_and_names",
+	  options::parse_flags<ExecMode, options::ValidateUTF8::values_and_names> );
+
+	auto ret = daw::json::benchmark::benchmark(
+	  DAW_NUM_RUNS, doc.size( ), std::string( name ) + " separate UTF-8 pass",
+	  []( auto const &sv ) {
+		  daw_json_ensure( json_details::is_valid_utf8( simd_exec_tag{ },
+		                                                std::data( sv ),
+		                                                daw::data_end( sv ) ),
+		                   ErrorReason::InvalidUTFCodepoint );
+		  return from_json<T>( sv, options::parse_flags<ExecMode> );
+	  },
+	  doc );
+	test_assert( ret.has_value( ), "Expected a value" );
+}
+
+template<options::ExecModeTypes ExecMode>
+void test_mode( std::string_view unicode_doc, std::string_view twitter_doc ) {
+	std::cout << "Using " << to_string( ExecMode )
+	          << " exec model\n*********************************************\n";
+	test_doc<std::vector<unicode_data>, ExecMode>( "full_unicode", unicode_doc );
+	test_doc<daw::twitter::twitter_object_t, ExecMode>( "twitter", twitter_doc );
+}
+
+int main( int argc, char **argv )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	if( argc < 3 ) {
+		std::cerr << "Must supply a path to full_unicode.json and twitter.json\n";
+		exit( 1 );
+	}
+	auto const unicode_doc = *daw::read_file( argv[1] );
+	auto const twitter_doc = *daw::read_file( argv[2] );
+	test_assert( unicode_doc.size( ) > 2, "Minimum json data size is 2 '{}'" );
+	test_assert( twitter_doc.size( ) > 2, "Minimum json data size is 2 '{}'" );
+
+	test_mode<options::ExecModeTypes::runtime>( unicode_doc, twitter_doc );
+	if constexpr( not std::is_same_v<simd_exec_tag, runtime_exec_tag> ) {
+		test_mode<options::ExecModeTypes::simd>( unicode_doc, twitter_doc );
+	}
+	if constexpr( not std::is_same_v<avx2_exec_tag, simd_exec_tag> ) {
+		test_mode<options::ExecModeTypes::avx2>( unicode_doc, twitter_doc );
+	}
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,141 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  With options::ValidateUTF8 the string values, and optionally the member
+//  names, must be valid UTF-8.  Check sequences that cross the 16 and 32 byte
+//  block boundaries of the SIMD validators, next to escapes and at the ends of
+//  the strings
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+struct utf8_t {
+	std::string a;
+	std::string_view b;
+
+	bool operator==( utf8_t const &rhs ) const {
+		return a == rhs.a and b == rhs.b;
+	}
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<utf8_t> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		using type = json_member_list<json_link<a, std::string>,
+		                              json_string_raw<b, std::string_view>>;
+	};
+} // namespace daw::json
+
+using namespace daw::json;
+
+constexpr std::string_view valid_sequences[] = {
+  "\xc3\xa9", "\xe2\x82\xac", "\xf0\x9f\x98\x80", "\xed\x9f\xbf",
+  "\xef\xbf\xbf", "\xf4\x8f\xbf\xbf" };
+
+constexpr std::string_view invalid_sequences[] = {
+  "\xc3",         "\x80",         "\xc0\x80",         "\xe0\x80\x80",
+  "\xed\xa0\x80", "\xe2\x82",     "\xf4\x90\x80\x80", "\xf5\x80\x80\x80",
+  "\xff",         "\xf0\x9f\x98", "\xc1\xbf",         "\xf0\x8f\xbf\xbf" };
+
+// The unmapped member is first, so that its name is read when looking for a
+std::string make_doc( std::string const &a, std::string const &b,
+                      std::string const &name = "c" ) {
+	return R"({")" + name + R"(":1,"a":")" + a + R"(","b":")" + b + R"("})";
+}
+
+template<options::ExecModeTypes ExecMode, options::ValidateUTF8 Validate>
+bool parses( std::string const &doc ) {
+#ifdef DAW_USE_EXCEPTIONS
+	try {
+#endif
+		(void)from_json<utf8_t>( doc, options::parse_flags<ExecMode, Validate> );
+		return true;
+#ifdef DAW_USE_EXCEPTIONS
+	} catch( json_exception const &jex ) {
+		test_assert( jex.reason_type( ) == ErrorReason::InvalidUTFCodepoint,
+		             "Expected an invalid UTF-8 error" );
+		return false;
+	}
+#endif
+}
+
+template<options::ExecModeTypes ExecMode>
+void test_mode( ) {
+	constexpr auto values = options::ValidateUTF8::values;
+	constexpr auto names = options::ValidateUTF8::values_and_names;
+	for( std::size_t pad = 0; pad < 40; ++pad ) {
+		auto const p = std::string( pad, 'x' );
+		for( auto seq : valid_sequences ) {
+			auto const s = std::string( seq );
+			auto const doc = make_doc( p + s + p + s, s + p, p + s );
+			auto const expected = from_json<utf8_t>( doc );
+			auto const result = from_json<utf8_t>(
+			  doc, options::parse_flags<ExecMode, names> );
+			test_assert( result == expected, "Expected the same result" );
+			// Next to escapes, which take the slow path when unescaping
+			test_assert( ( parses<ExecMode, values>(
+			               make_doc( p + R"(\n)" + s + R"(\")" + p, p ) ) ),
+			             "Expected valid UTF-8 next to escapes" );
+		}
+		for( auto seq : invalid_sequences ) {
+			auto const s = std::string( seq );
+			if constexpr( use_daw_json_exceptions_v ) {
+				test_assert(
+				  ( not parses<ExecMode, values>( make_doc( p + s + p, "" ) ) ),
+				  "Expected invalid UTF-8 in a value" );
+				test_assert(
+				  ( not parses<ExecMode, values>( make_doc( p + R"(\t)" + s, "" ) ) ),
+				  "Expected invalid UTF-8 after an escape" );
+				test_assert( ( not parses<ExecMode, values>( make_doc( "", p + s ) ) ),
+				             "Expected invalid UTF-8 in a raw value" );
+				test_assert(
+				  ( not parses<ExecMode, names>( make_doc( "", "", p + s ) ) ),
+				  "Expected invalid UTF-8 in a name" );
+			}
+			test_assert( ( parses<ExecMode, options::ValidateUTF8::no>(
+			               make_doc( p + s + p, p + s ) ) ),
+			             "Expected no UTF-8 checks by default" );
+			test_assert( ( parses<ExecMode, values>( make_doc( "", "", p + s ) ) ),
+			             "Expected no UTF-8 checks of names" );
+		}
+	}
+}
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_mode<options::ExecModeTypes::compile_time>( );
+	test_mode<options::ExecModeTypes::runtime>( );
+	test_mode<options::ExecModeTypes::simd>( );
+	test_mode<options::ExecModeTypes::avx2>( );
+	test_mode<options::ExecModeTypes::dispatch>( );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
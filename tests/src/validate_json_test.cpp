@@ -0,0 +1,174 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  Check validate_json on valid and invalid documents in each exec mode, and
+//  that from_json_validated parses valid documents and reports invalid ones
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_validate.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+struct validated_t {
+	std::string a;
+	std::vector<double> b;
+	bool c;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<validated_t> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		static constexpr char const c[] = "c";
+		using type =
+		  json_member_list<json_link<a, std::string>,
+		                   json_link<b, std::vector<double>>, json_link<c, bool>>;
+	};
+} // namespace daw::json
+
+using namespace daw::json;
+
+constexpr std::string_view valid_docs[] = {
+  "{}",
+  "[]",
+  " 1 ",
+  "-0.5e+10",
+  "0",
+  "null",
+  R"("aé\n\"\\\/\b\f\r\t")",
+  R"({"a":[1,2,{"b":null}],"c":true,"d":false,"e":-1.5E-3})",
+  "[[[[]]],[{}]]",
+  "\"\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80\"",
+  R"("😀")",
+  "  [ 1 ,\t2 ]\r\n",
+  R"({"a string that is longer than a couple of blocks of data":"and a value that is longer than that too, to use the full blocks"})" };
+
+constexpr std::string_view invalid_docs[] = {
+  "",           " ",         "{",         "[1,]",       R"({"a":1,})",
+  "01",         "1.",        "-",         "1e",         "1e+",
+  "tru",        "truex",     "[1 2]",     R"({"a" 1})", "{1:2}",
+  R"("abc)",    "\"\x01\"",  R"("\x")",   R"("\u12G4")", "[}",
+  "{]",         "1 2",       "[1]]",      R"({"a":})",  ".5",
+  "+1",         "nul",       R"(["a",])", "[1,,2]",    R"({"a":1 "b":2})",
+  "// c\n{}",   "\v[]" };
+
+constexpr std::string_view invalid_utf8_docs[] = {
+  "\"\xc3\"",             "\"\xc0\x80\"",
+  "\"\xed\xa0\x80\"",     "\"\xf4\x90\x80\x80\"",
+  R"("\ud83d")",          R"("\ude00")",
+  "\"\xff\"",             "\"\xe2\x82\"" };
+
+// The strings are checked once, by validate_json, and the parse that follows
+// is unchecked.  The other options are kept
+template<auto... PolicyFlags>
+constexpr bool is_validated_parse_unchecked( ) {
+	constexpr auto parse_flags =
+	  json_details::from_json_validated_flags_v<PolicyFlags...>;
+	using ParseState = BasicParsePolicy<parse_flags>;
+	return not ParseState::is_validate_utf8_values and
+	       not ParseState::is_validate_utf8_names and
+	       json_details::get_bits_for<options::CheckedParseMode>( parse_flags ) ==
+	         options::CheckedParseMode::no and
+	       std::is_same_v<
+	         typename ParseState::exec_tag_t,
+	         typename BasicParsePolicy<
+	           options::parse_flags_t<PolicyFlags...>::value>::exec_tag_t>;
+}
+static_assert( is_validated_parse_unchecked<>( ) );
+static_assert( is_validated_parse_unchecked<options::ValidateUTF8::values>( ) );
+static_assert( is_validated_parse_unchecked<
+               options::ValidateUTF8::values_and_names,
+               options::ExecModeTypes::simd>( ) );
+static_assert( is_validated_parse_unchecked<options::CheckedParseMode::yes,
+                                            options::ValidateUTF8::values>( ) );
+
+template<options::ExecModeTypes ExecMode>
+void test_mode( ) {
+	constexpr auto flags = options::parse_flags<ExecMode>;
+	for( auto doc : valid_docs ) {
+		test_assert( validate_json( doc, flags ), "Expected a valid document" );
+		test_assert( validate_json( doc, flags, true ),
+		             "Expected a valid document with UTF-8 checks" );
+	}
+	for( auto doc : invalid_docs ) {
+		test_assert( not validate_json( doc, flags ),
+		             "Expected an invalid document" );
+		test_assert( not validate_json( doc, flags, true ),
+		             "Expected an invalid document with UTF-8 checks" );
+	}
+	for( auto doc : invalid_utf8_docs ) {
+		test_assert( validate_json( doc, flags ),
+		             "Expected a valid document without UTF-8 checks" );
+		test_assert( not validate_json( doc, flags, true ),
+		             "Expected invalid UTF-8" );
+	}
+	// An error in a long string is found in the middle of a block
+	auto long_str = std::string( "[\"" ) + std::string( 100, 'x' ) + "\"]";
+	test_assert( validate_json( long_str, flags ), "Expected a valid string" );
+	long_str[57] = '\n';
+	auto const result = validate_json( long_str, flags );
+	test_assert( not result, "Expected a control character error" );
+	test_assert( result.reason == ErrorReason::InvalidString and
+	               result.position == 57,
+	             "Expected the position of the control character" );
+
+	constexpr std::string_view doc =
+	  R"({ "a": "a \"string\"", "b": [ 1, 2.5, -3e2 ], "c": true })";
+	auto const v = from_json_validated<validated_t>( doc, flags );
+	test_assert( v.a == R"(a "string")" and v.b.size( ) == 3 and
+	               v.b[2] == -300.0 and v.c,
+	             "Expected the parsed values" );
+#ifdef DAW_USE_EXCEPTIONS
+	bool has_error = false;
+	try {
+		(void)from_json_validated<validated_t>(
+		  R"({ "a": "x", "b": [ 1, 2, ], "c": true })", flags );
+	} catch( json_exception const &jex ) {
+		has_error = jex.reason_type( ) == ErrorReason::TrailingComma;
+	}
+	test_assert( has_error, "Expected a trailing comma error" );
+#endif
+}
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_mode<options::ExecModeTypes::compile_time>( );
+	test_mode<options::ExecModeTypes::runtime>( );
+	test_mode<options::ExecModeTypes::simd>( );
+	test_mode<options::ExecModeTypes::avx2>( );
+	test_assert( validate_json( valid_docs[7] ), "Expected a valid document" );
+	test_assert( from_json_validated<validated_t>(
+	               R"({"a":"","b":[],"c":false})" )
+	               .b.empty( ),
+	             "Expected the parsed values" );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
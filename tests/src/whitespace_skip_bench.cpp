@@ -0,0 +1,127 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  Compares parsing indented documents with the byte at a time whitespace
+//  skipping of the runtime exec mode and the block at a time skipping of the
+//  SIMD exec modes.  citm_catalog.json and citm_catalog_nws.json are the same
+//  document with and without the whitespace
+//
+
+#include "defines.h"
+
+#include "apache_builds_json.h"
+#include "citm_test_json.h"
+#include "daw_json_benchmark.h"
+
+#include <daw/daw_read_file.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 250;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+using namespace daw::json;
+
+template<options::ExecModeTypes ExecMode, options::CheckedParseMode Checked>
+void test( std::string_view apache_doc, std::string_view citm_doc,
+           std::string_view citm_nws_doc ) {
+	std::cout << "Using " << to_string( ExecMode ) << " exec model "
+	          << ( Checked == options::CheckedParseMode::yes ? "checked"
+	                                                         : "unchecked" )
+	          << "\n*********************************************\n";
+	{
+		auto ret = daw::json::benchmark::benchmark(
+		  DAW_NUM_RUNS, apache_doc.size( ), "apache_builds bench",
+		  []( auto const &sv ) {
+			  return from_json<apache_builds::apache_builds>(
+			    sv, options::parse_flags<ExecMode, Checked> );
+		  },
+		  apache_doc );
+		test_assert( ret.has_value( ), "Expected a value" );
+		test_assert( not ret.get( ).jobs.empty( ), "Expected values" );
+	}
+	auto const citm_bench = []( std::string_view title, std::string_view doc ) {
+		auto ret = daw::json::benchmark::benchmark(
+		  DAW_NUM_RUNS, doc.size( ), title,
+		  []( auto const &sv ) {
+			  return from_json<daw::citm::citm_object_t>(
+			    sv, options::parse_flags<ExecMode, Checked> );
+		  },
+		  doc );
+		test_assert( ret.has_value( ), "Expected a value" );
+		test_assert( not ret.get( ).areaNames.empty( ), "Expected values" );
+		return ret.get( ).areaNames.size( );
+	};
+	auto const citm_count = citm_bench( "citm bench", citm_doc );
+	auto const citm_nws_count = citm_bench( "citm no whitespace bench",
+	                                        citm_nws_doc );
+	test_assert( citm_count == citm_nws_count,
+	             "Expected the same document with and without whitespace" );
+}
+
+template<options::ExecModeTypes ExecMode>
+void test_mode( std::string_view apache_doc, std::string_view citm_doc,
+                std::string_view citm_nws_doc ) {
+	test<ExecMode, options::CheckedParseMode::yes>( apache_doc, citm_doc,
+	                                                citm_nws_doc );
+	test<ExecMode, options::CheckedParseMode::no>( apache_doc, citm_doc,
+	                                               citm_nws_doc );
+}
+
+int main( int argc, char **argv )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	if( argc < 4 ) {
+		std::cerr << "Must supply a path to apache_builds.json, citm_catalog.json "
+		             "and citm_catalog_nws.json\n";
+		exit( 1 );
+	}
+	auto const apache_doc = *daw::read_file( argv[1] );
+	auto const citm_doc = *daw::read_file( argv[2] );
+	auto const citm_nws_doc = *daw::read_file( argv[3] );
+	test_assert( apache_doc.size( ) > 2, "Minimum json data size is 2 '{}'" );
+	test_assert( citm_doc.size( ) > 2, "Minimum json data size is 2 '{}'" );
+	test_assert( citm_nws_doc.size( ) > 2, "Minimum json data size is 2 '{}'" );
+
+	test_mode<options::ExecModeTypes::runtime>( apache_doc, citm_doc,
+	                                            citm_nws_doc );
+	if constexpr( not std::is_same_v<simd_exec_tag, runtime_exec_tag> ) {
+		test_mode<options::ExecModeTypes::simd>( apache_doc, citm_doc,
+		                                         citm_nws_doc );
+	}
+	if constexpr( not std::is_same_v<avx2_exec_tag, simd_exec_tag> ) {
+		test_mode<options::ExecModeTypes::avx2>( apache_doc, citm_doc,
+		                                         citm_nws_doc );
+	}
+	test_mode<options::ExecModeTypes::dispatch>( apache_doc, citm_doc,
+	                                             citm_nws_doc );
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif